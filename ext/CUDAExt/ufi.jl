@@ -5,6 +5,7 @@
 # )
 #     task = create_task(rt, lib, JULIA_CUSTOM_GPU_TASK)
 #     add_scalar(task, Scalar(task_obj.task_id))
+#     add_scalar(task, Scalar(NO_RETURN))
 #     register_task_function(task_obj.task_id, task_obj.fun)
 #     return task
 # end
@@ -0,0 +1,88 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+
+// Arrow C data interface, copied verbatim from the specification
+// (https://arrow.apache.org/docs/format/CDataInterface.html). The guard lets
+// it coexist with other copies of the same definitions.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace legate_wrapper::arrow {
+
+// Moves the Arrow array at `array` (an ArrowArray*) into a new LogicalArray
+// and marks the source released. `schema` (an ArrowSchema*) is only read.
+//
+// Fixed-width columns and string/list payloads are attached without copying
+// and the producer's release callback runs once Legate frees the last of
+// them. Validity bitmaps, bool columns and offsets are converted, since Legate
+// stores one byte per mask entry and inclusive ranges instead of offsets.
+legate::LogicalArray import_array(void* array, const void* schema);
+
+// Exports `array` (1-D, or any dense row-major tile) into caller-provided
+// ArrowArray/ArrowSchema structs. Value and character buffers point into the
+// mapped instance, which the export keeps alive until it is released.
+void export_array(const legate::PhysicalArray& array, void* out_array,
+                  void* out_schema);
+
+}  // namespace legate_wrapper::arrow
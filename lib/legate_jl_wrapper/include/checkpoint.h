@@ -0,0 +1,68 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <string>
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// Manual launch over row blocks of an array. input(0): one block; scalar(0):
+// checkpoint directory. Byte-shuffles the block, delta- and run-length codes
+// each byte plane and writes the result to <dir>/tile_<color>.lgc.
+class CheckpointEncodeTask : public legate::LegateTask<CheckpointEncodeTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::CHECKPOINT_ENCODE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Same launch as CheckpointEncodeTask with output(0) in place of the input:
+// decodes <dir>/tile_<color>.lgc into the block.
+class CheckpointDecodeTask : public legate::LegateTask<CheckpointDecodeTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::CHECKPOINT_DECODE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+void register_checkpoint_tasks(legate::Library& library);
+
+// Writes `array` (bound, non-nullable, primitive) to the directory `dir`: a
+// text manifest with its type, shape and blocking, and one compressed file
+// per block written by its own point task.
+void write_checkpoint(const legate::LogicalArray& array, const std::string& dir);
+
+// Creates an array from the manifest in `dir` and fills it by decoding every
+// block in parallel, with the blocking the checkpoint was written with.
+legate::LogicalArray read_checkpoint(const std::string& dir);
+
+}  // namespace native
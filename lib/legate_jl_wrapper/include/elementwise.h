@@ -0,0 +1,124 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// The op codes below match the *_CODES tables in src/api/elementwise.jl
+
+enum class UnaryOp : std::int32_t {
+  NEG = 0,
+  ABS = 1,
+  SQRT = 2,  // SQRT .. COS are floating point only
+  EXP = 3,
+  LOG = 4,
+  SIN = 5,
+  COS = 6,
+  SQUARE = 7,
+};
+
+enum class BinaryOp : std::int32_t {
+  ADD = 0,
+  SUB = 1,
+  MUL = 2,
+  DIV = 3,  // truncating for integers
+  MIN = 4,
+  MAX = 5,
+  POW = 6,  // floating point only
+};
+
+enum class CompareOp : std::int32_t {
+  EQ = 0,
+  NE = 1,
+  LT = 2,
+  LE = 3,
+  GT = 4,
+  GE = 5,
+};
+
+// input(0), output(0) of the same type; scalar(0): UnaryOp
+class UnaryTask : public legate::LegateTask<UnaryTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::UNARY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0), [input(1)], output(0) of the same type; scalar(0): BinaryOp.
+// Without input(1) the right operand is scalar(1), of the input's type.
+class BinaryTask : public legate::LegateTask<BinaryTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::BINARY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0), input(1) of the same type, output(0) of bool; scalar(0): CompareOp
+class CompareTask : public legate::LegateTask<CompareTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::COMPARE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0) converted into output(0) of any other numeric or bool type
+class CastTask : public legate::LegateTask<CastTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::CAST_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// output(0) = alpha * input(0) + input(1); scalar(0): alpha of the input type.
+// output(0) may be the same store as input(1).
+class AxpyTask : public legate::LegateTask<AxpyTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::AXPY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+void register_elementwise_tasks(legate::Library& library);
+
+}  // namespace native
@@ -0,0 +1,95 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// Matches RANDOM_DISTRIBUTIONS in src/api/generators.jl
+enum class Distribution : std::int32_t {
+  UNIFORM = 0,  // [0, 1)
+  NORMAL = 1,   // mean 0, standard deviation 1
+};
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2,
+// 3"). A pure function of (counter, key): generating element i never depends
+// on any other element, so a store can be filled in any order or partition.
+inline std::array<std::uint32_t, 4> philox4x32(std::uint64_t counter,
+                                               std::uint64_t key) {
+  constexpr std::uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+  constexpr std::uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+  std::uint32_t c0 = static_cast<std::uint32_t>(counter);
+  std::uint32_t c1 = static_cast<std::uint32_t>(counter >> 32);
+  std::uint32_t c2 = 0, c3 = 0;
+  std::uint32_t k0 = static_cast<std::uint32_t>(key);
+  std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+  for (int round = 0; round < 10; ++round) {
+    const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c0;
+    const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c2;
+    const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    c1 = static_cast<std::uint32_t>(p1);
+    c3 = static_cast<std::uint32_t>(p0);
+    c0 = n0;
+    c2 = n2;
+    k0 += W0;
+    k1 += W1;
+  }
+  return {c0, c1, c2, c3};
+}
+
+// output(0); scalar(0): start, scalar(1): step, both of the output type;
+// scalar(2 .. 2+DIM): global extents. Element p gets start + step * i, where
+// i is the row-major linear index of p in the global shape.
+class IotaTask : public legate::LegateTask<IotaTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::IOTA_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// output(0) of float32 or float64; scalar(0): Distribution; scalar(1): uint64
+// seed; scalar(2 .. 2+DIM): global extents. Element p is drawn from Philox
+// keyed on the seed with the global linear index of p as the counter, so the
+// result is bit-identical for any partitioning or processor count.
+class RandomTask : public legate::LegateTask<RandomTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::RANDOM_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+void register_generator_tasks(legate::Library& library);
+
+}  // namespace native
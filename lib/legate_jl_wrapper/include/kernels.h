@@ -0,0 +1,167 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "legate.h"
+#include "types.h"
+
+#if defined(LEGATE_JL_OPENMP)
+#include <omp.h>
+#endif
+
+// Shared helpers for the built-in native tasks
+namespace native {
+
+// Element types the arithmetic kernels accept (FLOAT16 has no host type here)
+template <typename T>
+constexpr bool is_numeric_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template <typename T>
+constexpr T lowest() {
+  if constexpr (std::numeric_limits<T>::has_infinity) {
+    return -std::numeric_limits<T>::infinity();
+  } else {
+    return std::numeric_limits<T>::lowest();
+  }
+}
+
+template <typename T>
+constexpr T highest() {
+  if constexpr (std::numeric_limits<T>::has_infinity) {
+    return std::numeric_limits<T>::infinity();
+  } else {
+    return std::numeric_limits<T>::max();
+  }
+}
+
+// `fold` consumes one element, `combine` merges two partial results.
+template <typename T>
+struct SumOp {
+  using Acc = T;
+  static Acc identity() { return Acc{0}; }
+  static Acc fold(Acc a, T x) { return a + x; }
+  static Acc combine(Acc a, Acc b) { return a + b; }
+};
+
+template <typename T>
+struct ProdOp {
+  using Acc = T;
+  static Acc identity() { return Acc{1}; }
+  static Acc fold(Acc a, T x) { return a * x; }
+  static Acc combine(Acc a, Acc b) { return a * b; }
+};
+
+template <typename T>
+struct MinOp {
+  using Acc = T;
+  static Acc identity() { return highest<T>(); }
+  static Acc fold(Acc a, T x) { return std::min(a, x); }
+  static Acc combine(Acc a, Acc b) { return std::min(a, b); }
+};
+
+template <typename T>
+struct MaxOp {
+  using Acc = T;
+  static Acc identity() { return lowest<T>(); }
+  static Acc fold(Acc a, T x) { return std::max(a, x); }
+  static Acc combine(Acc a, Acc b) { return std::max(a, b); }
+};
+
+// Runs body(i) for i in [0, n). The loop body only touches element i, so the
+// compiler can vectorize it; `parallel` splits it over OpenMP threads.
+template <typename F>
+inline void dense_loop(std::size_t n, bool parallel, F&& body) {
+#if defined(LEGATE_JL_OPENMP)
+  if (parallel) {
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t i = 0; i < n; ++i) body(i);
+    return;
+  }
+#endif
+  for (std::size_t i = 0; i < n; ++i) body(i);
+}
+
+// Runs body(i) for i in [0, n) when each iteration does enough work that
+// vectorizing the loop itself does not pay off.
+template <typename F>
+inline void parallel_for(std::size_t n, bool parallel, F&& body) {
+#if defined(LEGATE_JL_OPENMP)
+  if (parallel) {
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < n; ++i) body(i);
+    return;
+  }
+#endif
+  for (std::size_t i = 0; i < n; ++i) body(i);
+}
+
+// out[p] = f(in[p]) over the shape of `out`
+template <typename OutT, typename InT, int DIM, typename F>
+void map_unary(const legate::PhysicalStore& out,
+               const legate::PhysicalStore& in, bool parallel, F&& f) {
+  auto rect = out.shape<DIM>();
+  if (rect.empty()) return;
+  auto w = out.write_accessor<OutT, DIM>(rect);
+  auto r = in.read_accessor<InT, DIM>(rect);
+  if (w.accessor.is_dense_row_major(rect) &&
+      r.accessor.is_dense_row_major(rect)) {
+    OutT* optr = w.ptr(rect.lo);
+    const InT* iptr = r.ptr(rect.lo);
+    dense_loop(rect.volume(), parallel,
+               [&](std::size_t i) { optr[i] = f(iptr[i]); });
+    return;
+  }
+  for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it) {
+    w[*it] = f(r[*it]);
+  }
+}
+
+// out[p] = f(a[p], b[p]) over the shape of `out`
+template <typename OutT, typename InT, int DIM, typename F>
+void map_binary(const legate::PhysicalStore& out,
+                const legate::PhysicalStore& a, const legate::PhysicalStore& b,
+                bool parallel, F&& f) {
+  auto rect = out.shape<DIM>();
+  if (rect.empty()) return;
+  auto w = out.write_accessor<OutT, DIM>(rect);
+  auto ra = a.read_accessor<InT, DIM>(rect);
+  auto rb = b.read_accessor<InT, DIM>(rect);
+  if (w.accessor.is_dense_row_major(rect) &&
+      ra.accessor.is_dense_row_major(rect) &&
+      rb.accessor.is_dense_row_major(rect)) {
+    OutT* optr = w.ptr(rect.lo);
+    const InT* aptr = ra.ptr(rect.lo);
+    const InT* bptr = rb.ptr(rect.lo);
+    dense_loop(rect.volume(), parallel,
+               [&](std::size_t i) { optr[i] = f(aptr[i], bptr[i]); });
+    return;
+  }
+  for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it) {
+    w[*it] = f(ra[*it], rb[*it]);
+  }
+}
+
+}  // namespace native
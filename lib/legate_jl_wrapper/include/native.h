@@ -0,0 +1,70 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "jlcxx/jlcxx.hpp"
+#include "legate.h"
+
+namespace native {
+// Task IDs of the built-in tasks. They live in their own library (see
+// native_library), so they do not collide with JULIA_CUSTOM_TASK.
+enum NativeTaskIDs {
+  REDUCE_TASK = 0,
+  ARG_REDUCE_TASK = 1,
+  UNARY_TASK = 2,
+  BINARY_TASK = 3,
+  COMPARE_TASK = 4,
+  CAST_TASK = 5,
+  AXPY_TASK = 6,
+  IOTA_TASK = 7,
+  RANDOM_TASK = 8,
+  SCAN_LOCAL_TASK = 9,
+  SCAN_FIXUP_TASK = 10,
+  SORT_SAMPLE_TASK = 11,
+  SORT_SPLITTERS_TASK = 12,
+  SORT_BUCKET_TASK = 13,
+  SPMV_TASK = 14,
+  TOUCH_TASK = 15,
+  MARKER_TASK = 16,
+  READY_TASK = 17,
+  NOTIFY_TASK = 18,
+  CHECKPOINT_ENCODE_TASK = 19,
+  CHECKPOINT_DECODE_TASK = 20,
+  SORT_RANGES_TASK = 21,
+};
+
+// Returns the library holding the built-in tasks, creating it and registering
+// their variants on first use.
+legate::Library native_library();
+
+// Number of tiles to split `n` elements into for a manual launch: one per
+// processor of the current machine, but never more than `n`.
+std::uint64_t launch_tiles(std::uint64_t n);
+
+// Creates a manual launch of `task_id` with one point per CPU of the current
+// machine. Tasks that record completion in process memory use it so that
+// every rank, each polling its own copy of that state, runs a point.
+legate::ManualTask create_on_every_cpu(legate::LocalTaskID task_id);
+
+}  // namespace native
+
+void wrap_native(jlcxx::Module& mod);
@@ -0,0 +1,61 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "legate.h"
+
+namespace native {
+
+// Advice accepted by advise_mapped; matches TILE_ADVICE in
+// src/api/outofcore.jl
+enum class TileAdvice : std::int32_t {
+  WILLNEED = 0,  // start reading the range in
+  EVICT = 1,     // write dirty pages back and drop the range from memory
+};
+
+// Maps `bytes` bytes of the file at `path` (MAP_SHARED). A writable mapping
+// creates or grows the file as needed; a read-only one requires it to be
+// large enough already.
+void* map_file(const std::string& path, std::size_t bytes, bool writable);
+
+// Undoes map_file for a mapping that was never attached.
+void unmap_file(void* ptr, std::size_t bytes);
+
+// Attaches a mapping from map_file as a row-major array. The mapping is
+// unmapped once Legate releases the allocation.
+legate::LogicalArray attach_mapped(void* ptr, std::size_t bytes,
+                                   const legate::Shape& shape,
+                                   const legate::Type& type, bool writable);
+
+// Rows [lo, hi) of the leading dimension of `array`, which is the byte range
+// a tile of a row-major mapping occupies.
+legate::LogicalArray tile_view(const legate::LogicalArray& array,
+                               std::int64_t lo, std::int64_t hi);
+
+// Applies `advice` to the page-aligned cover of [offset, offset + len) of a
+// mapping.
+void advise_mapped(void* ptr, std::size_t offset, std::size_t len,
+                   std::int32_t advice);
+
+}  // namespace native
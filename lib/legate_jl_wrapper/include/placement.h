@@ -0,0 +1,52 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// A task that does nothing. Its input carries the intent: the mapper brings a
+// valid copy of it into the memory of the processor the task runs on.
+class TouchTask : public legate::LegateTask<TouchTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::TOUCH_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+  static void gpu_variant(legate::TaskContext context);
+#endif
+};
+
+void register_placement_tasks(legate::Library& library);
+
+// Asynchronously makes a valid copy of `array` in `target` by reading it
+// from a task restricted to the processors whose data the default mapper
+// places there. SYSMEM, FBMEM and, in OpenMP builds, SOCKETMEM are supported.
+void prefetch(const legate::LogicalArray& array,
+              legate::mapping::StoreTarget target);
+
+}  // namespace native
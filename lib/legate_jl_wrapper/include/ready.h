@@ -0,0 +1,68 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// Reads its input array (which orders it after the array's producers) and
+// adds one per point into a scalar counter (reduction 0).
+class ReadyTask : public legate::LegateTask<ReadyTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::READY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// Reads the counter of a ReadyTask, so it runs once every point of that
+// launch has, and marks its ticket (scalar 0) as ready in the process it runs
+// in. Launched with one point per CPU so every rank sees the ticket; scalar(1)
+// is the number of points each rank runs.
+class NotifyTask : public legate::LegateTask<NotifyTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::NOTIFY_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+void register_ready_tasks(legate::Library& library);
+
+// Returns a ticket that becomes ready once every operation submitted so far
+// that writes `array` has finished. Later operations are not waited on.
+std::uint64_t watch(const legate::LogicalArray& array);
+
+// Non-blocking: whether the ticket from watch is ready.
+bool ticket_ready(std::uint64_t ticket);
+
+// Drops the bookkeeping of a ticket; it must not be queried afterwards. Safe
+// before the ticket is ready: its pending notify points then leave no trace.
+void forget_ticket(std::uint64_t ticket);
+
+}  // namespace native
@@ -0,0 +1,66 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// Matches REDUCE_CODES in src/api/reductions.jl
+enum class ReduceOp : std::int32_t {
+  SUM = 0,
+  PROD = 1,
+  MIN = 2,
+  MAX = 3,
+  SUMSQ = 4,  // sum of squares accumulated in double, for L2 norms
+  ARGMIN = 5,
+  ARGMAX = 6,
+};
+
+// input(0): any array; reduction(0): 1-element future-backed store;
+// scalar(0): ReduceOp (SUM, PROD, MIN, MAX or SUMSQ)
+class ReduceTask : public legate::LegateTask<ReduceTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::REDUCE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+// input(0): any array; output(0): unbound values; output(1): unbound int64
+// coordinates; scalar(0): ReduceOp (ARGMIN or ARGMAX). Each point task emits
+// its local best value and its DIM coordinates (or nothing if its tile is
+// empty), and the caller picks the global best.
+class ArgReduceTask : public legate::LegateTask<ArgReduceTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::ARG_REDUCE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+void register_reduction_tasks(legate::Library& library);
+
+}  // namespace native
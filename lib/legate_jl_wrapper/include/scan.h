@@ -0,0 +1,58 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+#include "native.h"
+
+namespace native {
+
+// Manual launch over the tiles of a 1-D array. input(0): tile of the array;
+// output(0): same tile of the result; output(1): one-element tile of the
+// per-tile totals; scalar(0): ReduceOp (SUM, PROD, MIN or MAX)
+class ScanLocalTask : public legate::LegateTask<ScanLocalTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SCAN_LOCAL_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// input(0): all per-tile totals; input(1)/output(0): tile of the result;
+// scalar(0): ReduceOp. Folds the totals of the preceding tiles into the tile.
+class ScanFixupTask : public legate::LegateTask<ScanFixupTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SCAN_FIXUP_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+void register_scan_tasks(legate::Library& library);
+
+// Inclusive scan of the 1-D array `in` into `out` (bound, same shape and
+// type): a local scan of each tile, then a fixup that folds in the totals of
+// all preceding tiles.
+void inclusive_scan(const legate::LogicalArray& in,
+                    const legate::LogicalArray& out, std::int32_t op);
+
+}  // namespace native
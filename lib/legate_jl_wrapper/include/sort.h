@@ -0,0 +1,84 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+#include "native.h"
+
+namespace native {
+
+// Manual launch over P tiles. input(0): tile of the values; output(0): the
+// tile sorted stably; output(1): int64 source index of each sorted value;
+// [output(2): P - 1 regularly spaced samples of the sorted tile]; scalar(0):
+// int64 index base.
+class SortSampleTask : public legate::LegateTask<SortSampleTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SORT_SAMPLE_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// Single point. input(0): all P * (P - 1) samples; output(0): P - 1 splitters
+class SortSplittersTask : public legate::LegateTask<SortSplittersTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SORT_SPLITTERS_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// Manual launch over P tiles. input(0): sorted tile; [input(1): the P - 1
+// splitters]; output(0): column t of the P x P Rect<1> store, where row c
+// holds the run of the sorted tile that falls in bucket c. Bucket c holds the
+// values v with exactly c splitters <= v, so equal keys never straddle
+// buckets and the concatenation of the buckets is a stable sort.
+class SortRangesTask : public legate::LegateTask<SortRangesTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SORT_RANGES_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+// input(0): whole rows of the run store; input(1), input(2): image of those
+// runs in the sorted tiles and their source indices; output(0): unbound
+// sorted values of these buckets; output(1): unbound int64 source indices.
+// Without inputs it only binds both outputs empty (sorting an empty array).
+class SortBucketTask : public legate::LegateTask<SortBucketTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SORT_BUCKET_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+};
+
+void register_sort_tasks(legate::Library& library);
+
+// Stable sample sort of the 1-D array `in`, ordering NaNs last. `values` and `indices` must be
+// unbound 1-D arrays of in's type and int64; they receive the sorted values
+// and the position (counted from `index_base`) each one came from.
+void sample_sort(const legate::LogicalArray& in,
+                 const legate::LogicalArray& values,
+                 const legate::LogicalArray& indices, std::int64_t index_base);
+
+}  // namespace native
@@ -0,0 +1,59 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// y = A * x for a CSR matrix A. output(0): y; input(0): pos, the Rect<1>
+// range of each row into crd/vals; input(1): crd, int64 column of each
+// nonzero; input(2): vals; input(3): x.
+class SpMVTask : public legate::LegateTask<SpMVTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::SPMV_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+};
+
+void register_sparse_tasks(legate::Library& library);
+
+// Builds the Rect<1> row-range store of a CSR matrix from a zero-based row
+// pointer array of length rows + 1.
+legate::LogicalStore csr_pos_from_rowptr(
+    const std::vector<std::int64_t>& rowptr);
+
+// Launches SpMVTask. y and pos are partitioned by rows; crd and vals take
+// the image of pos, and x the image of crd, so each processor receives only
+// the nonzeros of its rows and the entries of x those nonzeros reference.
+void spmv(const legate::LogicalStore& pos, const legate::LogicalStore& crd,
+          const legate::LogicalStore& vals, const legate::LogicalStore& x,
+          const legate::LogicalStore& y);
+
+}  // namespace native
@@ -21,6 +21,7 @@
 
 #include "jlcxx/jlcxx.hpp"
 #include "legate.h"
+#include "types.h"
 
 namespace ufi {
 enum TaskIDs {
@@ -38,6 +39,9 @@ class JuliaCustomTask : public legate::LegateTask<JuliaCustomTask> {
       legate::TaskConfig{legate::LocalTaskID{ufi::JULIA_CUSTOM_TASK}};
 
   static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
 };
 
 #if LEGATE_DEFINED(LEGATE_USE_CUDA)
@@ -3,6 +3,12 @@
 #include "jlcxx/jlcxx.hpp"
 #include "legate.h"
 
+// OpenMP variants need both an OpenMP-enabled Legate and an OpenMP toolchain
+// (LEGATE_JL_WRAPPER_OPENMP is set by CMake when one is found).
+#if LEGATE_DEFINED(LEGATE_USE_OPENMP) && defined(LEGATE_JL_WRAPPER_OPENMP)
+#define LEGATE_JL_OPENMP 1
+#endif
+
 namespace legate_util {
 template <legate::Type::Code CODE>
 struct code_to_cxx;
@@ -45,6 +51,10 @@ void wrap_type_enums(jlcxx::Module&);
 // specified legate::Type. (e.g. legate::int8())
 void wrap_type_getters(jlcxx::Module&);
 
+// Wraps legate::ReductionOpKind used by
+// reduction arguments and task return values
+void wrap_reduction_ops(jlcxx::Module&);
+
 // Wraps the privilege modes used in
 // FieldAccessor (AcessorRO, AccessorWO)
 void wrap_privilege_modes(jlcxx::Module&);
@@ -0,0 +1,58 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "legate.h"
+#include "native.h"
+#include "types.h"
+
+namespace native {
+
+// Records that every operation submitted before it has finished: it is
+// launched right after a non-blocking execution fence, one point per CPU, and
+// each point stores its sequence number (scalar 0) into the process-wide
+// counter of its rank when it runs.
+class MarkerTask : public legate::LegateTask<MarkerTask> {
+ public:
+  static inline const auto TASK_CONFIG =
+      legate::TaskConfig{legate::LocalTaskID{native::MARKER_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+#if defined(LEGATE_JL_OPENMP)
+  static void omp_variant(legate::TaskContext context);
+#endif
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+  static void gpu_variant(legate::TaskContext context);
+#endif
+};
+
+void register_window_tasks(legate::Library& library);
+
+// Submits a marker behind everything submitted so far and returns its
+// sequence number. Sequence numbers start at 1 and increase by one per call.
+std::uint64_t issue_marker();
+
+// The highest sequence number whose marker has run, or 0 if none has. Safe to
+// poll from any thread without blocking.
+std::uint64_t completed_marker();
+
+}  // namespace native
@@ -17,6 +17,9 @@
  *            Ethan Meitz <emeitz@andrew.cmu.edu>
  */
 
+#include <cstring>
+#include <stdexcept>
+
 #include "legate.h"
 #include "legate/io/hdf5/interface.h"
 #include "legate/mapping/machine.h"
@@ -395,6 +398,77 @@ inline void* get_ptr(legate::PhysicalStore* store) {
   return legate::double_dispatch(dim, code, GetPtrFunctor{}, store);
 }
 
+/**
+ * @ingroup legate_wrapper
+ * @brief Get the element strides of a PhysicalStore, one per dimension.
+ *
+ * Views made by store transforms (transpose, project, broadcast, ...) are
+ * mapped onto their source's instance, so they are in general neither dense
+ * nor row-major. Broadcast dimensions have stride 0.
+ *
+ * @param store Pointer to the PhysicalStore.
+ */
+inline std::vector<int64_t> element_strides(legate::PhysicalStore* store) {
+  std::vector<int64_t> strides(store->dim(), 0);
+  const auto size = static_cast<int64_t>(store->type().size());
+  if (strides.empty() || size == 0 || store->domain().empty()) return strides;
+  auto alloc = store->get_inline_allocation();
+  for (std::size_t d = 0; d < strides.size(); ++d) {
+    strides[d] = static_cast<int64_t>(alloc.strides[d]) / size;
+  }
+  return strides;
+}
+
+/**
+ * @ingroup legate_wrapper
+ * @brief Broadcast view of an array: dimension `dim`, of extent 1, repeated
+ * `dim_size` times without copying.
+ *
+ * @param array A non-nullable LogicalArray.
+ * @param dim The dimension to broadcast.
+ * @param dim_size The new extent of `dim`.
+ */
+inline LogicalArray broadcast_array(const LogicalArray& array, int32_t dim,
+                                    size_t dim_size) {
+  if (array.nullable()) {
+    throw std::invalid_argument("nullable arrays cannot be broadcast");
+  }
+  return LogicalArray{array.data().broadcast(dim, dim_size)};
+}
+
+/**
+ * @ingroup legate_wrapper
+ * @brief Copy the single element of a scalar store into `dst`.
+ *
+ * Blocks only on the producers of `store` (for future-backed stores, on the
+ * future itself) rather than on a full execution fence.
+ *
+ * @param store A one-element LogicalStore.
+ * @param dst Destination buffer of at least `store.type().size()` bytes.
+ */
+inline void read_scalar_store(const LogicalStore& store, void* dst) {
+  if (store.volume() != 1) {
+    throw std::invalid_argument("read_scalar_store expects a 1-element store");
+  }
+  auto ps = store.get_physical_store();
+  auto alloc = ps.get_inline_allocation();
+  std::memcpy(dst, alloc.ptr, store.type().size());
+}
+
+/**
+ * @ingroup legate_wrapper
+ * @brief Fill every element of an array with a scalar value.
+ *
+ * Issued as a Legate fill, so no task body runs and the value is not
+ * materialized until the array is used.
+ *
+ * @param array The LogicalArray to fill.
+ * @param value Scalar of the array's element type.
+ */
+inline void issue_fill(const LogicalArray& array, const Scalar& value) {
+  Runtime::get_runtime()->issue_fill(array, value);
+}
+
 inline std::shared_ptr<LogicalStorePartition> partition_by_tiling(
     LogicalStore& store, std::vector<uint64_t> tile_shape) {
   return std::make_shared<LogicalStorePartition>(
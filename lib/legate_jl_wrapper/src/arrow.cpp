@@ -0,0 +1,363 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "arrow.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "legate.h"
+
+namespace legate_wrapper::arrow {
+
+namespace {
+
+// An imported ArrowArray. The producer's release callback runs when the last
+// store attached to one of its buffers is freed.
+struct Imported {
+  ArrowArray array{};
+
+  ~Imported() {
+    if (array.release != nullptr) array.release(&array);
+  }
+};
+
+using Owner = std::shared_ptr<Imported>;
+
+// Keeps the exported tile mapped and owns the buffers converted for Arrow.
+struct Exported {
+  legate::PhysicalArray source;
+  std::vector<std::uint8_t> validity;
+  std::vector<std::uint8_t> values;
+  std::vector<std::int64_t> offsets;
+  std::vector<const void*> buffers;
+};
+
+void release_array(ArrowArray* array) {
+  delete static_cast<Exported*>(array->private_data);
+  array->release = nullptr;
+}
+
+void release_schema(ArrowSchema* schema) {
+  delete static_cast<std::string*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+legate::Type primitive_type(std::string_view format) {
+  if (format == "c") return legate::int8();
+  if (format == "C") return legate::uint8();
+  if (format == "s") return legate::int16();
+  if (format == "S") return legate::uint16();
+  if (format == "i") return legate::int32();
+  if (format == "I") return legate::uint32();
+  if (format == "l") return legate::int64();
+  if (format == "L") return legate::uint64();
+  if (format == "e") return legate::float16();
+  if (format == "f") return legate::float32();
+  if (format == "g") return legate::float64();
+  throw std::invalid_argument("unsupported Arrow format \"" +
+                              std::string{format} + "\"");
+}
+
+const char* primitive_format(legate::Type::Code code) {
+  switch (code) {
+    case legate::Type::Code::INT8:
+      return "c";
+    case legate::Type::Code::UINT8:
+      return "C";
+    case legate::Type::Code::INT16:
+      return "s";
+    case legate::Type::Code::UINT16:
+      return "S";
+    case legate::Type::Code::INT32:
+      return "i";
+    case legate::Type::Code::UINT32:
+      return "I";
+    case legate::Type::Code::INT64:
+      return "l";
+    case legate::Type::Code::UINT64:
+      return "L";
+    case legate::Type::Code::FLOAT16:
+      return "e";
+    case legate::Type::Code::FLOAT32:
+      return "f";
+    case legate::Type::Code::FLOAT64:
+      return "g";
+    default:
+      throw std::invalid_argument("type has no Arrow equivalent");
+  }
+}
+
+legate::LogicalStore empty_store(const legate::Type& type) {
+  return legate::Runtime::get_runtime()->create_store(legate::Shape{0}, type);
+}
+
+// Attaches `count` elements at `ptr`, which stay valid as long as `owner`.
+legate::LogicalStore attach_borrowed(const Owner& owner, const void* ptr,
+                                     std::uint64_t count,
+                                     const legate::Type& type) {
+  if (count == 0) return empty_store(type);
+  auto alloc = legate::ExternalAllocation::create_sysmem(
+      const_cast<void*>(ptr), count * type.size(), true /*read_only*/,
+      // the reference to `owner` goes away with the deleter
+      [owner](void* /*ptr*/) {});
+  return legate::Runtime::get_runtime()->create_store(legate::Shape{count},
+                                                      type, alloc);
+}
+
+template <typename T>
+legate::LogicalStore attach_owned(std::unique_ptr<T[]> data,
+                                  std::uint64_t count,
+                                  const legate::Type& type) {
+  if (count == 0) return empty_store(type);
+  auto alloc = legate::ExternalAllocation::create_sysmem(
+      data.get(), count * sizeof(T), true /*read_only*/,
+      [](void* ptr) { delete[] static_cast<T*>(ptr); });
+  data.release();
+  return legate::Runtime::get_runtime()->create_store(legate::Shape{count},
+                                                      type, alloc);
+}
+
+bool bit(const void* bitmap, std::int64_t i) {
+  return (static_cast<const std::uint8_t*>(bitmap)[i >> 3] >> (i & 7)) & 1;
+}
+
+std::unique_ptr<bool[]> unpack_bits(const void* bitmap, std::int64_t offset,
+                                    std::int64_t length) {
+  auto out = std::make_unique<bool[]>(length);
+  for (std::int64_t i = 0; i < length; ++i) out[i] = bit(bitmap, offset + i);
+  return out;
+}
+
+// Packs `n` bools into an LSB-first bitmap and counts the unset ones.
+std::vector<std::uint8_t> pack_bits(const bool* values, std::uint64_t n,
+                                    std::int64_t* unset) {
+  std::vector<std::uint8_t> bits((n + 7) / 8, 0);
+  for (std::uint64_t i = 0; i < n; ++i) {
+    if (values[i]) {
+      bits[i >> 3] |= static_cast<std::uint8_t>(1u << (i & 7));
+    } else {
+      ++*unset;
+    }
+  }
+  return bits;
+}
+
+std::optional<legate::LogicalStore> import_validity(const ArrowArray& array) {
+  if (array.null_count == 0 || array.buffers[0] == nullptr) {
+    return std::nullopt;
+  }
+  return attach_owned(unpack_bits(array.buffers[0], array.offset, array.length),
+                      array.length, legate::bool_());
+}
+
+legate::LogicalArray with_validity(
+    const legate::LogicalStore& data,
+    const std::optional<legate::LogicalStore>& mask) {
+  if (!mask) return legate::LogicalArray{data};
+  return legate::Runtime::get_runtime()->create_nullable_array(data, *mask);
+}
+
+// Converts Arrow offsets into the inclusive ranges of a Legate descriptor and
+// returns it with the number of payload elements the offsets reach.
+template <typename Offset>
+std::pair<legate::LogicalStore, std::uint64_t> import_ranges(
+    const ArrowArray& array) {
+  if (array.length == 0) return {empty_store(legate::rect_type(1)), 0};
+  const auto* offsets =
+      static_cast<const Offset*>(array.buffers[1]) + array.offset;
+  auto ranges = std::make_unique<legate::Rect<1>[]>(array.length);
+  for (std::int64_t i = 0; i < array.length; ++i) {
+    ranges[i] = legate::Rect<1>{
+        legate::Point<1>{static_cast<legate::coord_t>(offsets[i])},
+        legate::Point<1>{static_cast<legate::coord_t>(offsets[i + 1]) - 1}};
+  }
+  const auto end = static_cast<std::uint64_t>(offsets[array.length]);
+  return {attach_owned(std::move(ranges), array.length, legate::rect_type(1)),
+          end};
+}
+
+legate::LogicalArray import_column(const Owner& owner, const ArrowArray& array,
+                                   const ArrowSchema& schema) {
+  if (schema.dictionary != nullptr) {
+    throw std::invalid_argument(
+        "dictionary-encoded Arrow arrays are not supported");
+  }
+  auto* runtime = legate::Runtime::get_runtime();
+  const std::string_view format{schema.format};
+  const auto length = static_cast<std::uint64_t>(array.length);
+  auto validity = import_validity(array);
+
+  if (format == "b") {
+    auto values = unpack_bits(array.buffers[1], array.offset, array.length);
+    return with_validity(
+        attach_owned(std::move(values), length, legate::bool_()), validity);
+  }
+  if (format == "u" || format == "U") {
+    auto [ranges, chars] = format == "u"
+                               ? import_ranges<std::int32_t>(array)
+                               : import_ranges<std::int64_t>(array);
+    auto vardata = legate::LogicalArray{
+        attach_borrowed(owner, array.buffers[2], chars, legate::int8())};
+    return runtime->create_string_array(with_validity(ranges, validity),
+                                        vardata);
+  }
+  if (format == "+l" || format == "+L") {
+    if (array.n_children != 1 || schema.n_children != 1) {
+      throw std::invalid_argument("Arrow list arrays must have one child");
+    }
+    auto ranges = format == "+l" ? import_ranges<std::int32_t>(array).first
+                                 : import_ranges<std::int64_t>(array).first;
+    auto vardata =
+        import_column(owner, *array.children[0], *schema.children[0]);
+    return runtime->create_list_array(with_validity(ranges, validity),
+                                      vardata);
+  }
+
+  auto type = primitive_type(format);
+  const auto* values = static_cast<const std::byte*>(array.buffers[1]) +
+                       array.offset * type.size();
+  return with_validity(attach_borrowed(owner, values, length, type), validity);
+}
+
+// Base pointer and volume of a store mapped as one dense row-major block in
+// host-accessible memory.
+std::pair<const void*, std::uint64_t> dense_span(
+    const legate::PhysicalStore& store) {
+  const auto domain = store.domain();
+  const auto volume = static_cast<std::uint64_t>(domain.get_volume());
+  if (volume == 0) return {nullptr, 0};
+  auto alloc = store.get_inline_allocation();
+  if (alloc.target == legate::mapping::StoreTarget::FBMEM) {
+    throw std::invalid_argument(
+        "Arrow export needs a tile mapped to host memory");
+  }
+  auto expected = static_cast<std::size_t>(store.type().size());
+  for (auto d = store.dim() - 1; d >= 0; --d) {
+    const auto extent =
+        static_cast<std::size_t>(domain.hi()[d] - domain.lo()[d] + 1);
+    if (extent > 1 && alloc.strides[d] != expected) {
+      throw std::invalid_argument(
+          "only dense row-major tiles can be exported to Arrow");
+    }
+    expected *= extent;
+  }
+  return {alloc.ptr, volume};
+}
+
+}  // namespace
+
+legate::LogicalArray import_array(void* array, const void* schema) {
+  auto* source = static_cast<ArrowArray*>(array);
+  if (source->release == nullptr) {
+    throw std::invalid_argument("the Arrow array was already released");
+  }
+  // move the array, as the interface prescribes for consumers
+  auto owner = std::make_shared<Imported>();
+  owner->array = *source;
+  source->release = nullptr;
+  return import_column(owner, owner->array,
+                       *static_cast<const ArrowSchema*>(schema));
+}
+
+void export_array(const legate::PhysicalArray& array, void* out_array,
+                  void* out_schema) {
+  auto exported = std::make_unique<Exported>(Exported{array, {}, {}, {}, {}});
+  auto format = std::make_unique<std::string>();
+  std::int64_t length = 0;
+  std::int64_t null_count = 0;
+  const void* values = nullptr;
+  const void* chars = nullptr;
+  const auto code = array.type().code();
+
+  if (code == legate::Type::Code::STRING) {
+    auto strings = array.as_string_array();
+    auto ranges = strings.ranges().data();
+    auto payload = strings.chars().data();
+    const auto rect = ranges.shape<1>();
+    const auto chars_lo = payload.shape<1>().lo[0];
+    chars = dense_span(payload).first;
+    length = static_cast<std::int64_t>(rect.volume());
+    auto acc = ranges.read_accessor<legate::Rect<1>, 1, false>();
+    exported->offsets.reserve(length + 1);
+    for (auto i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+      exported->offsets.push_back(acc[i].lo[0] - chars_lo);
+    }
+    exported->offsets.push_back(
+        length == 0 ? 0 : acc[rect.hi[0]].hi[0] + 1 - chars_lo);
+    values = exported->offsets.data();
+    *format = "U";
+  } else {
+    auto [ptr, volume] = dense_span(array.data());
+    length = static_cast<std::int64_t>(volume);
+    if (code == legate::Type::Code::BOOL) {
+      std::int64_t unset = 0;
+      exported->values =
+          pack_bits(static_cast<const bool*>(ptr), volume, &unset);
+      values = exported->values.data();
+      *format = "b";
+    } else {
+      values = ptr;
+      *format = primitive_format(code);
+    }
+  }
+
+  const void* validity = nullptr;
+  if (array.nullable()) {
+    auto [mask, volume] = dense_span(array.null_mask());
+    exported->validity =
+        pack_bits(static_cast<const bool*>(mask), volume, &null_count);
+    validity = exported->validity.data();
+  }
+
+  exported->buffers = {validity, values};
+  if (code == legate::Type::Code::STRING) exported->buffers.push_back(chars);
+
+  auto* out = static_cast<ArrowArray*>(out_array);
+  out->length = length;
+  out->null_count = null_count;
+  out->offset = 0;
+  out->n_buffers = static_cast<std::int64_t>(exported->buffers.size());
+  out->n_children = 0;
+  out->buffers = exported->buffers.data();
+  out->children = nullptr;
+  out->dictionary = nullptr;
+  out->release = release_array;
+  out->private_data = exported.release();
+
+  auto* schema = static_cast<ArrowSchema*>(out_schema);
+  schema->format = format->c_str();
+  schema->name = "";
+  schema->metadata = nullptr;
+  schema->flags = array.nullable() ? ARROW_FLAG_NULLABLE : 0;
+  schema->n_children = 0;
+  schema->children = nullptr;
+  schema->dictionary = nullptr;
+  schema->release = release_schema;
+  schema->private_data = format.release();
+}
+
+}  // namespace legate_wrapper::arrow
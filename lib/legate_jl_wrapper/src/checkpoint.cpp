@@ -0,0 +1,449 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "checkpoint.h"
+
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+constexpr std::uint32_t kMagic = 0x4b43474c;  // "LGCK"
+constexpr std::uint32_t kVersion = 1;
+constexpr char kManifestHeader[] = "legate-jl-checkpoint";
+constexpr std::size_t kMaxRun = 128;
+
+// Leads every block file. One encoded length per byte plane follows, then the
+// planes in order.
+struct BlockHeader {
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint64_t elements;
+  std::uint64_t elem_size;
+};
+
+template <typename T>
+constexpr bool is_checkpointable_v =
+    std::is_arithmetic_v<T> || std::is_same_v<T, std::complex<float>> ||
+    std::is_same_v<T, std::complex<double>>;
+
+// Host-side twin of is_checkpointable_v, for type codes
+bool is_checkpointable(legate::Type::Code code) {
+  switch (code) {
+    case legate::Type::Code::BOOL:
+    case legate::Type::Code::INT8:
+    case legate::Type::Code::INT16:
+    case legate::Type::Code::INT32:
+    case legate::Type::Code::INT64:
+    case legate::Type::Code::UINT8:
+    case legate::Type::Code::UINT16:
+    case legate::Type::Code::UINT32:
+    case legate::Type::Code::UINT64:
+    case legate::Type::Code::FLOAT32:
+    case legate::Type::Code::FLOAT64:
+    case legate::Type::Code::COMPLEX64:
+    case legate::Type::Code::COMPLEX128:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::filesystem::path block_path(const std::string& dir,
+                                 legate::coord_t color) {
+  return std::filesystem::path{dir} /
+         ("tile_" + std::to_string(color) + ".lgc");
+}
+
+// Reads the header of the block file at `path` and checks that it holds
+// `elements` values of `elem_size` bytes. Leaves `in` at the plane lengths.
+void read_block_header(std::ifstream& in, const std::filesystem::path& path,
+                       std::uint64_t elements, std::uint64_t elem_size) {
+  BlockHeader header{};
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!in || header.magic != kMagic || header.version != kVersion) {
+    throw std::runtime_error(path.string() + " is not a checkpoint block");
+  }
+  if (header.elem_size != elem_size || header.elements != elements) {
+    throw std::runtime_error(path.string() +
+                             " does not match the checkpoint manifest");
+  }
+}
+
+// Writes through a temporary file, so a crash never leaves a torn file behind
+template <typename F>
+void write_atomically(const std::filesystem::path& path, F&& write) {
+  auto tmp = path;
+  tmp += ".tmp";
+  {
+    std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+    write(out);
+    if (!out) throw std::runtime_error("could not write " + tmp.string());
+  }
+  std::filesystem::rename(tmp, path);
+}
+
+// Copies a block into `raw` in row-major order
+struct GatherFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(const legate::PhysicalStore& store,
+                  std::vector<std::uint8_t>& raw) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_checkpointable_v<T>) {
+      throw std::invalid_argument(
+          "checkpoints support boolean, integer, floating-point and complex "
+          "arrays");
+    } else {
+      auto rect = store.shape<DIM>();
+      raw.resize(rect.volume() * sizeof(T));
+      if (rect.empty()) return;
+      auto acc = store.read_accessor<T, DIM>(rect);
+      auto* dst = reinterpret_cast<T*>(raw.data());
+      for (legate::PointInRectIterator<DIM> it{rect}; it.valid(); ++it) {
+        *dst++ = acc[*it];
+      }
+    }
+  }
+};
+
+// Inverse of GatherFunctor
+struct ScatterFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(const legate::PhysicalStore& store,
+                  const std::vector<std::uint8_t>& raw) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_checkpointable_v<T>) {
+      throw std::invalid_argument(
+          "checkpoints support boolean, integer, floating-point and complex "
+          "arrays");
+    } else {
+      auto rect = store.shape<DIM>();
+      if (rect.empty()) return;
+      auto acc = store.write_accessor<T, DIM>(rect);
+      const auto* src = reinterpret_cast<const T*>(raw.data());
+      for (legate::PointInRectIterator<DIM> it{rect}; it.valid(); ++it) {
+        acc[*it] = *src++;
+      }
+    }
+  }
+};
+
+// Byte `b` of each of the `n` elements, delta coded against the previous
+// element, then run-length coded: a control byte c < 0x80 precedes c + 1
+// literal bytes and c >= 0x80 stands for (c & 0x7f) + 1 zero bytes. Smooth
+// fields change slowly in their high-order bytes, so those planes collapse to
+// a few zero runs.
+void encode_plane(const std::uint8_t* raw, std::size_t n, std::size_t size,
+                  std::size_t b, std::vector<std::uint8_t>& out) {
+  std::vector<std::uint8_t> delta(n);
+  std::uint8_t prev = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::uint8_t v = raw[i * size + b];
+    delta[i] = static_cast<std::uint8_t>(v - prev);
+    prev = v;
+  }
+  std::size_t i = 0;
+  while (i < n) {
+    std::size_t run = 0;
+    while (i + run < n && run < kMaxRun && delta[i + run] == 0) ++run;
+    if (run >= 2) {
+      out.push_back(static_cast<std::uint8_t>(0x80 | (run - 1)));
+      i += run;
+      continue;
+    }
+    // literals up to the next pair of zeros
+    const std::size_t start = i;
+    while (i < n && i - start < kMaxRun &&
+           !(delta[i] == 0 && i + 1 < n && delta[i + 1] == 0)) {
+      ++i;
+    }
+    out.push_back(static_cast<std::uint8_t>(i - start - 1));
+    out.insert(out.end(), delta.begin() + start, delta.begin() + i);
+  }
+}
+
+// Inverse of encode_plane. Returns false on malformed input instead of
+// throwing, since it runs inside OpenMP loops.
+bool decode_plane(const std::uint8_t* in, std::size_t length, std::size_t n,
+                  std::size_t size, std::size_t b, std::uint8_t* raw) {
+  std::size_t pos = 0;
+  std::size_t i = 0;
+  std::uint8_t prev = 0;
+  while (pos < length && i < n) {
+    const std::uint8_t c = in[pos++];
+    const bool zeros = (c & 0x80) != 0;
+    const std::size_t count = (c & 0x7f) + 1;
+    if (i + count > n || (!zeros && pos + count > length)) return false;
+    for (std::size_t k = 0; k < count; ++k, ++i) {
+      if (!zeros) prev = static_cast<std::uint8_t>(prev + in[pos++]);
+      raw[i * size + b] = prev;
+    }
+  }
+  return i == n && pos == length;
+}
+
+void encode_block(legate::TaskContext& context, bool parallel) {
+  auto store = context.input(0).data();
+  const auto dir = context.scalar(0).value<std::string>();
+  const auto color = context.get_task_index()[0];
+
+  std::vector<std::uint8_t> raw;
+  legate::double_dispatch(store.dim(), store.type().code(), GatherFunctor{},
+                          store, raw);
+  const std::size_t size = store.type().size();
+  const std::size_t n = raw.size() / size;
+  std::vector<std::vector<std::uint8_t>> planes(size);
+  parallel_for(size, parallel, [&](std::size_t b) {
+    encode_plane(raw.data(), n, size, b, planes[b]);
+  });
+
+  write_atomically(block_path(dir, color), [&](std::ofstream& out) {
+    const BlockHeader header{kMagic, kVersion, n, size};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& plane : planes) {
+      const std::uint64_t length = plane.size();
+      out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+    for (const auto& plane : planes) {
+      out.write(reinterpret_cast<const char*>(plane.data()),
+                static_cast<std::streamsize>(plane.size()));
+    }
+  });
+}
+
+void decode_block(legate::TaskContext& context, bool parallel) {
+  auto store = context.output(0).data();
+  const auto dir = context.scalar(0).value<std::string>();
+  const auto path = block_path(dir, context.get_task_index()[0]);
+
+  std::ifstream in{path, std::ios::binary};
+  const std::size_t size = store.type().size();
+  const auto n = static_cast<std::size_t>(store.domain().get_volume());
+  read_block_header(in, path, n, size);
+  std::vector<std::uint64_t> offsets(size + 1, 0);
+  for (std::size_t b = 0; b < size; ++b) {
+    in.read(reinterpret_cast<char*>(&offsets[b + 1]), sizeof(std::uint64_t));
+    offsets[b + 1] += offsets[b];
+  }
+  std::vector<std::uint8_t> encoded(offsets[size]);
+  in.read(reinterpret_cast<char*>(encoded.data()),
+          static_cast<std::streamsize>(encoded.size()));
+  if (!in) throw std::runtime_error("truncated checkpoint " + path.string());
+
+  std::vector<std::uint8_t> raw(n * size);
+  std::vector<char> ok(size, 0);
+  parallel_for(size, parallel, [&](std::size_t b) {
+    ok[b] = decode_plane(encoded.data() + offsets[b],
+                         offsets[b + 1] - offsets[b], n, size, b, raw.data());
+  });
+  for (char plane_ok : ok) {
+    if (!plane_ok) {
+      throw std::runtime_error("corrupt checkpoint " + path.string());
+    }
+  }
+  legate::double_dispatch(store.dim(), store.type().code(), ScatterFunctor{},
+                          store, raw);
+}
+
+}  // namespace
+
+/*static*/ void CheckpointEncodeTask::cpu_variant(
+    legate::TaskContext context) {
+  encode_block(context, false);
+}
+
+/*static*/ void CheckpointDecodeTask::cpu_variant(
+    legate::TaskContext context) {
+  decode_block(context, false);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void CheckpointEncodeTask::omp_variant(
+    legate::TaskContext context) {
+  encode_block(context, true);
+}
+
+/*static*/ void CheckpointDecodeTask::omp_variant(
+    legate::TaskContext context) {
+  decode_block(context, true);
+}
+#endif
+
+void register_checkpoint_tasks(legate::Library& library) {
+  CheckpointEncodeTask::register_variants(library);
+  CheckpointDecodeTask::register_variants(library);
+}
+
+namespace {
+
+// Set while block files written by this process may still be in flight
+std::atomic<bool> writes_in_flight{false};
+
+struct Manifest {
+  legate::Type::Code code;
+  std::vector<std::uint64_t> extents;
+  std::uint64_t block_rows;
+  std::uint64_t blocks;
+};
+
+// Launches `task_id` over the row blocks of `store`, one file per block
+void launch_blocks(legate::LocalTaskID task_id, legate::LogicalStore store,
+                   const Manifest& m, const std::string& dir, bool output) {
+  if (m.blocks == 0) return;
+  auto* runtime = legate::Runtime::get_runtime();
+  auto tile = m.extents;
+  tile[0] = m.block_rows;
+  const legate::Domain launch{
+      legate::Rect<1>{0, static_cast<legate::coord_t>(m.blocks) - 1}};
+  auto task = runtime->create_task(native_library(), task_id, launch);
+  auto blocks = store.partition_by_tiling(tile);
+  if (output) {
+    task.add_output(blocks);
+  } else {
+    task.add_input(blocks);
+  }
+  task.add_scalar_arg(legate::Scalar{dir});
+  runtime->submit(std::move(task));
+}
+
+}  // namespace
+
+void write_checkpoint(const legate::LogicalArray& array,
+                      const std::string& dir) {
+  if (array.unbound() || array.nullable() || array.nested() ||
+      array.dim() == 0) {
+    throw std::invalid_argument(
+        "checkpoints need a bound, non-nullable array with at least one "
+        "dimension");
+  }
+  auto store = array.data();
+  if (!is_checkpointable(store.type().code())) {
+    throw std::invalid_argument(
+        "checkpoints support boolean, integer, floating-point and complex "
+        "arrays");
+  }
+  Manifest m{store.type().code(), {}, 0, 0};
+  auto shape = store.shape();
+  for (std::uint32_t d = 0; d < store.dim(); ++d) m.extents.push_back(shape[d]);
+  const std::uint64_t rows = m.extents[0];
+  if (rows > 0 && store.volume() > 0) {
+    const std::uint64_t tiles = launch_tiles(rows);
+    m.block_rows = (rows + tiles - 1) / tiles;
+    m.blocks = (rows + m.block_rows - 1) / m.block_rows;
+  }
+
+  std::ostringstream manifest;
+  manifest << kManifestHeader << ' ' << kVersion << '\n'
+           << "type " << static_cast<std::int32_t>(m.code) << '\n'
+           << "shape";
+  for (auto e : m.extents) manifest << ' ' << e;
+  manifest << '\n'
+           << "block_rows " << m.block_rows << '\n'
+           << "blocks " << m.blocks << '\n';
+
+  std::filesystem::create_directories(dir);
+  write_atomically(std::filesystem::path{dir} / "manifest",
+                   [&](std::ofstream& out) { out << manifest.str(); });
+  launch_blocks(legate::LocalTaskID{CHECKPOINT_ENCODE_TASK}, store, m, dir,
+                false);
+  // The blocks are written asynchronously; later launches, such as the
+  // decodes of a read_checkpoint, must not run before them
+  legate::Runtime::get_runtime()->issue_execution_fence(false);
+  writes_in_flight.store(true);
+}
+
+legate::LogicalArray read_checkpoint(const std::string& dir) {
+  // The block headers are checked here on the host, so blocks this process
+  // is still writing must land first
+  if (writes_in_flight.exchange(false)) {
+    legate::Runtime::get_runtime()->issue_execution_fence(true /*block*/);
+  }
+  const auto path = std::filesystem::path{dir} / "manifest";
+  std::ifstream in{path};
+  std::string header, key;
+  std::uint32_t version = 0;
+  std::int32_t code = 0;
+  std::uint32_t ndim = 0;
+  Manifest m{};
+  in >> header >> version >> key >> code >> key;
+  if (!in || header != kManifestHeader || version != kVersion) {
+    throw std::runtime_error(path.string() + " is not a checkpoint manifest");
+  }
+  // the shape line holds as many extents as the array has dimensions
+  std::string line;
+  std::getline(in, line);
+  std::istringstream extents{line};
+  for (std::uint64_t e; extents >> e; ++ndim) m.extents.push_back(e);
+  in >> key >> m.block_rows >> key >> m.blocks;
+  if (!in || ndim == 0) {
+    throw std::runtime_error("malformed checkpoint manifest " + path.string());
+  }
+  m.code = static_cast<legate::Type::Code>(code);
+  if (!is_checkpointable(m.code)) {
+    throw std::runtime_error("unsupported element type in checkpoint " +
+                             path.string());
+  }
+  const auto type = legate::primitive_type(m.code);
+  const std::uint64_t rows = m.extents[0];
+  if (m.blocks > 0 && (m.block_rows == 0 || m.blocks * m.block_rows < rows ||
+                       (m.blocks - 1) * m.block_rows >= rows)) {
+    throw std::runtime_error("malformed checkpoint manifest " + path.string());
+  }
+
+  // A missing or mismatched block would otherwise only fail inside a decode
+  // task, after the array has been handed back
+  std::uint64_t row_elements = 1;
+  for (std::size_t d = 1; d < m.extents.size(); ++d) {
+    row_elements *= m.extents[d];
+  }
+  for (std::uint64_t b = 0; b < m.blocks; ++b) {
+    const auto block = block_path(dir, static_cast<legate::coord_t>(b));
+    std::ifstream file{block, std::ios::binary};
+    if (!file) {
+      throw std::runtime_error("missing checkpoint block " + block.string());
+    }
+    const std::uint64_t block_rows =
+        std::min(m.block_rows, rows - b * m.block_rows);
+    read_block_header(file, block, block_rows * row_elements, type.size());
+  }
+
+  auto array = legate::Runtime::get_runtime()->create_array(
+      legate::Shape{m.extents}, type);
+  launch_blocks(legate::LocalTaskID{CHECKPOINT_DECODE_TASK}, array.data(), m,
+                dir, true);
+  return array;
+}
+
+}  // namespace native
@@ -0,0 +1,306 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "elementwise.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+template <typename T>
+constexpr bool is_castable_v = std::is_arithmetic_v<T>;
+
+[[noreturn]] void unsupported(const char* what) {
+  throw std::invalid_argument(what);
+}
+
+struct UnaryFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(UnaryOp op, const legate::PhysicalStore& in,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      unsupported("elementwise ops support integer and floating-point arrays");
+    } else {
+      auto map = [&](auto f) { map_unary<T, T, DIM>(out, in, parallel, f); };
+      switch (op) {
+        case UnaryOp::NEG:
+          return map([](T x) { return static_cast<T>(-x); });
+        case UnaryOp::ABS:
+          if constexpr (std::is_unsigned_v<T>) {
+            return map([](T x) { return x; });
+          } else {
+            return map([](T x) { return static_cast<T>(x < T{0} ? -x : x); });
+          }
+        case UnaryOp::SQUARE:
+          return map([](T x) { return static_cast<T>(x * x); });
+        default:
+          break;
+      }
+      if constexpr (std::is_floating_point_v<T>) {
+        switch (op) {
+          case UnaryOp::SQRT:
+            return map([](T x) { return std::sqrt(x); });
+          case UnaryOp::EXP:
+            return map([](T x) { return std::exp(x); });
+          case UnaryOp::LOG:
+            return map([](T x) { return std::log(x); });
+          case UnaryOp::SIN:
+            return map([](T x) { return std::sin(x); });
+          case UnaryOp::COS:
+            return map([](T x) { return std::cos(x); });
+          default:
+            break;
+        }
+      }
+      unsupported("unsupported unary op for this element type");
+    }
+  }
+};
+
+template <typename T, typename Map>
+void apply_binary(BinaryOp op, Map&& map) {
+  switch (op) {
+    case BinaryOp::ADD:
+      return map([](T a, T b) { return static_cast<T>(a + b); });
+    case BinaryOp::SUB:
+      return map([](T a, T b) { return static_cast<T>(a - b); });
+    case BinaryOp::MUL:
+      return map([](T a, T b) { return static_cast<T>(a * b); });
+    case BinaryOp::DIV:
+      if constexpr (std::is_floating_point_v<T>) {
+        return map([](T a, T b) { return static_cast<T>(a / b); });
+      }
+      break;
+    case BinaryOp::MIN:
+      return map([](T a, T b) { return std::min(a, b); });
+    case BinaryOp::MAX:
+      return map([](T a, T b) { return std::max(a, b); });
+    case BinaryOp::POW:
+      if constexpr (std::is_floating_point_v<T>) {
+        return map([](T a, T b) { return std::pow(a, b); });
+      }
+      break;
+  }
+  unsupported("unsupported binary op for this element type");
+}
+
+struct BinaryFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(BinaryOp op, legate::TaskContext& context,
+                  const legate::PhysicalStore& a,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      unsupported("elementwise ops support integer and floating-point arrays");
+    } else if (context.num_inputs() > 1) {
+      auto b = context.input(1).data();
+      apply_binary<T>(op, [&](auto f) {
+        map_binary<T, T, DIM>(out, a, b, parallel, f);
+      });
+    } else {
+      const T rhs = context.scalar(1).value<T>();
+      apply_binary<T>(op, [&](auto f) {
+        map_unary<T, T, DIM>(out, a, parallel, [=](T x) { return f(x, rhs); });
+      });
+    }
+  }
+};
+
+struct CompareFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(CompareOp op, const legate::PhysicalStore& a,
+                  const legate::PhysicalStore& b,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_castable_v<T>) {
+      unsupported(
+          "comparisons support bool, integer and floating-point arrays");
+    } else {
+      auto map = [&](auto f) {
+        map_binary<bool, T, DIM>(out, a, b, parallel, f);
+      };
+      switch (op) {
+        case CompareOp::EQ:
+          return map([](T x, T y) { return x == y; });
+        case CompareOp::NE:
+          return map([](T x, T y) { return x != y; });
+        case CompareOp::LT:
+          return map([](T x, T y) { return x < y; });
+        case CompareOp::LE:
+          return map([](T x, T y) { return x <= y; });
+        case CompareOp::GT:
+          return map([](T x, T y) { return x > y; });
+        case CompareOp::GE:
+          return map([](T x, T y) { return x >= y; });
+      }
+      unsupported("unsupported comparison");
+    }
+  }
+};
+
+template <typename InT, int DIM>
+struct CastToFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(const legate::PhysicalStore& in,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using OutT = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_castable_v<OutT>) {
+      unsupported("casts support bool, integer and floating-point arrays");
+    } else {
+      map_unary<OutT, InT, DIM>(out, in, parallel,
+                                [](InT x) { return static_cast<OutT>(x); });
+    }
+  }
+};
+
+struct CastFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(const legate::PhysicalStore& in,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using InT = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_castable_v<InT>) {
+      unsupported("casts support bool, integer and floating-point arrays");
+    } else {
+      legate::type_dispatch(out.type().code(), CastToFunctor<InT, DIM>{}, in,
+                            out, parallel);
+    }
+  }
+};
+
+struct AxpyFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(const legate::Scalar& alpha, const legate::PhysicalStore& x,
+                  const legate::PhysicalStore& y,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      unsupported("axpy supports integer and floating-point arrays");
+    } else {
+      const T a = alpha.value<T>();
+      map_binary<T, T, DIM>(out, x, y, parallel, [a](T xi, T yi) {
+        return static_cast<T>(a * xi + yi);
+      });
+    }
+  }
+};
+
+void unary(legate::TaskContext& context, bool parallel) {
+  auto in = context.input(0).data();
+  auto out = context.output(0).data();
+  auto op = static_cast<UnaryOp>(context.scalar(0).value<std::int32_t>());
+  legate::double_dispatch(in.dim(), in.type().code(), UnaryFunctor{}, op, in,
+                          out, parallel);
+}
+
+void binary(legate::TaskContext& context, bool parallel) {
+  auto a = context.input(0).data();
+  auto out = context.output(0).data();
+  auto op = static_cast<BinaryOp>(context.scalar(0).value<std::int32_t>());
+  legate::double_dispatch(a.dim(), a.type().code(), BinaryFunctor{}, op,
+                          context, a, out, parallel);
+}
+
+void compare(legate::TaskContext& context, bool parallel) {
+  auto a = context.input(0).data();
+  auto b = context.input(1).data();
+  auto out = context.output(0).data();
+  auto op = static_cast<CompareOp>(context.scalar(0).value<std::int32_t>());
+  legate::double_dispatch(a.dim(), a.type().code(), CompareFunctor{}, op, a, b,
+                          out, parallel);
+}
+
+void cast(legate::TaskContext& context, bool parallel) {
+  auto in = context.input(0).data();
+  auto out = context.output(0).data();
+  legate::double_dispatch(in.dim(), in.type().code(), CastFunctor{}, in, out,
+                          parallel);
+}
+
+void axpy(legate::TaskContext& context, bool parallel) {
+  auto x = context.input(0).data();
+  auto y = context.input(1).data();
+  auto out = context.output(0).data();
+  legate::double_dispatch(x.dim(), x.type().code(), AxpyFunctor{},
+                          context.scalar(0), x, y, out, parallel);
+}
+
+}  // namespace
+
+/*static*/ void UnaryTask::cpu_variant(legate::TaskContext context) {
+  unary(context, false);
+}
+
+/*static*/ void BinaryTask::cpu_variant(legate::TaskContext context) {
+  binary(context, false);
+}
+
+/*static*/ void CompareTask::cpu_variant(legate::TaskContext context) {
+  compare(context, false);
+}
+
+/*static*/ void CastTask::cpu_variant(legate::TaskContext context) {
+  cast(context, false);
+}
+
+/*static*/ void AxpyTask::cpu_variant(legate::TaskContext context) {
+  axpy(context, false);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void UnaryTask::omp_variant(legate::TaskContext context) {
+  unary(context, true);
+}
+
+/*static*/ void BinaryTask::omp_variant(legate::TaskContext context) {
+  binary(context, true);
+}
+
+/*static*/ void CompareTask::omp_variant(legate::TaskContext context) {
+  compare(context, true);
+}
+
+/*static*/ void CastTask::omp_variant(legate::TaskContext context) {
+  cast(context, true);
+}
+
+/*static*/ void AxpyTask::omp_variant(legate::TaskContext context) {
+  axpy(context, true);
+}
+#endif
+
+void register_elementwise_tasks(legate::Library& library) {
+  UnaryTask::register_variants(library);
+  BinaryTask::register_variants(library);
+  CompareTask::register_variants(library);
+  CastTask::register_variants(library);
+  AxpyTask::register_variants(library);
+}
+
+}  // namespace native
@@ -0,0 +1,199 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "generator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+// Elements per unit of parallel work along the last dimension
+constexpr legate::coord_t BLOCK = 4096;
+
+// Row-major strides of the global shape passed as scalars [first, first+DIM)
+template <int DIM>
+std::array<std::int64_t, DIM> global_strides(legate::TaskContext& context,
+                                             std::uint32_t first) {
+  std::array<std::int64_t, DIM> strides{};
+  std::int64_t stride = 1;
+  for (int d = DIM - 1; d >= 0; --d) {
+    strides[d] = stride;
+    stride *= context.scalar(first + d).value<std::int64_t>();
+  }
+  return strides;
+}
+
+// Calls f(p, i) for every point p of `rect`, where i is the global linear
+// index of p. Blocks of each last-dimension row are spread over threads.
+template <int DIM, typename F>
+void for_each_global(const legate::Rect<DIM>& rect,
+                     const std::array<std::int64_t, DIM>& strides,
+                     bool parallel, F&& f) {
+  if (rect.empty()) return;
+  const legate::coord_t row_len = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  const std::size_t nrows = rect.volume() / static_cast<std::size_t>(row_len);
+  const auto row_blocks =
+      static_cast<std::size_t>((row_len + BLOCK - 1) / BLOCK);
+
+  parallel_for(nrows * row_blocks, parallel, [&](std::size_t block) {
+    legate::Point<DIM> p = rect.lo;
+    std::size_t row = block / row_blocks;
+    for (int d = DIM - 2; d >= 0; --d) {
+      const auto extent = static_cast<std::size_t>(rect.hi[d] - rect.lo[d] + 1);
+      p[d] = rect.lo[d] + static_cast<legate::coord_t>(row % extent);
+      row /= extent;
+    }
+    const legate::coord_t begin =
+        static_cast<legate::coord_t>(block % row_blocks) * BLOCK;
+    const legate::coord_t end = std::min(row_len, begin + BLOCK);
+    p[DIM - 1] += begin;
+
+    std::int64_t index = 0;
+    for (int d = 0; d < DIM; ++d) index += p[d] * strides[d];
+    for (legate::coord_t j = begin; j < end; ++j, ++index) {
+      f(p, index);
+      ++p[DIM - 1];
+    }
+  });
+}
+
+template <typename T>
+T uniform(const std::array<std::uint32_t, 4>& bits, int word) {
+  if constexpr (std::is_same_v<T, float>) {
+    return static_cast<float>(bits[word] >> 8) * 0x1.0p-24f;
+  } else {
+    const std::uint64_t x =
+        (static_cast<std::uint64_t>(bits[word]) << 32) | bits[word + 1];
+    return static_cast<double>(x >> 11) * 0x1.0p-53;
+  }
+}
+
+// Box-Muller on two uniforms taken from one Philox block
+template <typename T>
+T normal(const std::array<std::uint32_t, 4>& bits) {
+  constexpr T TWO_PI = static_cast<T>(6.283185307179586);
+  const int second = std::is_same_v<T, float> ? 1 : 2;
+  const T u1 = T{1} - uniform<T>(bits, 0);  // (0, 1], keeps log finite
+  const T u2 = uniform<T>(bits, second);
+  return std::sqrt(T{-2} * std::log(u1)) * std::cos(TWO_PI * u2);
+}
+
+struct IotaFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "iota supports integer and floating-point arrays");
+    } else {
+      const T start = context.scalar(0).value<T>();
+      const T step = context.scalar(1).value<T>();
+      auto rect = out.shape<DIM>();
+      auto w = out.write_accessor<T, DIM>(rect);
+      for_each_global(rect, global_strides<DIM>(context, 2), parallel,
+                      [&](const legate::Point<DIM>& p, std::int64_t i) {
+                        w[p] = static_cast<T>(start + step * static_cast<T>(i));
+                      });
+    }
+  }
+};
+
+struct RandomFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(legate::TaskContext& context,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!std::is_same_v<T, float> && !std::is_same_v<T, double>) {
+      throw std::invalid_argument("random arrays must be Float32 or Float64");
+    } else {
+      const auto dist =
+          static_cast<Distribution>(context.scalar(0).value<std::int32_t>());
+      const auto seed = context.scalar(1).value<std::uint64_t>();
+      auto rect = out.shape<DIM>();
+      auto w = out.write_accessor<T, DIM>(rect);
+      const auto strides = global_strides<DIM>(context, 2);
+      switch (dist) {
+        case Distribution::UNIFORM:
+          for_each_global(rect, strides, parallel,
+                          [&](const legate::Point<DIM>& p, std::int64_t i) {
+                            w[p] = uniform<T>(philox4x32(i, seed), 0);
+                          });
+          return;
+        case Distribution::NORMAL:
+          for_each_global(rect, strides, parallel,
+                          [&](const legate::Point<DIM>& p, std::int64_t i) {
+                            w[p] = normal<T>(philox4x32(i, seed));
+                          });
+          return;
+      }
+      throw std::invalid_argument("unsupported random distribution");
+    }
+  }
+};
+
+void iota(legate::TaskContext& context, bool parallel) {
+  auto out = context.output(0).data();
+  legate::double_dispatch(out.dim(), out.type().code(), IotaFunctor{}, context,
+                          out, parallel);
+}
+
+void generate_random(legate::TaskContext& context, bool parallel) {
+  auto out = context.output(0).data();
+  legate::double_dispatch(out.dim(), out.type().code(), RandomFunctor{},
+                          context, out, parallel);
+}
+
+}  // namespace
+
+/*static*/ void IotaTask::cpu_variant(legate::TaskContext context) {
+  iota(context, false);
+}
+
+/*static*/ void RandomTask::cpu_variant(legate::TaskContext context) {
+  generate_random(context, false);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void IotaTask::omp_variant(legate::TaskContext context) {
+  iota(context, true);
+}
+
+/*static*/ void RandomTask::omp_variant(legate::TaskContext context) {
+  generate_random(context, true);
+}
+#endif
+
+void register_generator_tasks(legate::Library& library) {
+  IotaTask::register_variants(library);
+  RandomTask::register_variants(library);
+}
+
+}  // namespace native
@@ -22,8 +22,10 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow.h"
 #include "jlcxx/jlcxx.hpp"
 #include "jlcxx/stl.hpp"
+#include "native.h"
 #include "task.h"
 #include "types.h"
 #include "wrapper.inl"
@@ -115,6 +117,7 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
   wrap_privilege_modes(mod);
   wrap_type_enums(mod);
   wrap_type_getters(mod);
+  wrap_reduction_ops(mod);
 
   using privilege_modes = ParameterList<
       std::integral_constant<legion_privilege_mode_t, LEGION_WRITE_DISCARD>,
@@ -153,6 +156,10 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
   scalar.constructor([](std::complex<float> v) { return new Scalar(v); })
       .constructor([](std::complex<double> v) { return new Scalar(v); })
       .constructor<void*>();
+  // Scalar of a compound type (see compound_type in Julia), copied from `data`
+  mod.method("_compound_scalar", [](const legate::Type& type, void* data) {
+    return Scalar{type, data, true /*copy*/};
+  });
 
   mod.add_type<Parametric<TypeVar<1>>>("StdOptional")
       .apply<std::optional<legate::Type>, std::optional<int64_t>>(
@@ -190,11 +197,29 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
   mod.method("slice", [](LogicalStore& s, int32_t dim, legate::Slice sl) {
     return s.slice(dim, sl);
   });
+  mod.method("_transpose", [](LogicalStore& s, std::vector<int32_t> axes) {
+    return s.transpose(std::move(axes));
+  });
+  mod.method("project", [](LogicalStore& s, int32_t dim, int64_t index) {
+    return s.project(dim, index);
+  });
+  mod.method("delinearize",
+             [](LogicalStore& s, int32_t dim, std::vector<uint64_t> sizes) {
+               return s.delinearize(dim, std::move(sizes));
+             });
+  mod.method("_broadcast",
+             [](LogicalStore& s, int32_t dim, size_t dim_size) {
+               return s.broadcast(dim, dim_size);
+             });
   mod.method(
       "get_physical_store",
       [](LogicalStore& s, std::optional<legate::mapping::StoreTarget> target) {
         return s.get_physical_store(target);
       });
+  mod.method("offload_to",
+             [](LogicalStore& s, legate::mapping::StoreTarget target) {
+               s.offload_to(target);
+             });
   mod.method("equal_storage", [](LogicalStore& s, LogicalStore& other) {
     return s.equal_storage(other);
   });
@@ -222,16 +247,37 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
       .method("dim", &PhysicalArray::dim)
       .method("type", &PhysicalArray::type)
       .method("nullable", &PhysicalArray::nullable)
+      .method("null_mask", &PhysicalArray::null_mask)  // returns PhysicalStore
       .method("data", &PhysicalArray::data);  // returns PhysicalStore
 
   mod.add_type<LogicalArray>("LogicalArrayImpl")
       .method("dim", &LogicalArray::dim)
       .method("type", &LogicalArray::type)
       .method("nullable", &LogicalArray::nullable)
+      .method("null_mask", &LogicalArray::null_mask)  // returns LogicalStore
       .method("data", &LogicalArray::data)  // returns LogicalStore
       .method("get_physical_array",
               &LogicalArray::get_physical_array)  // return PhysicalArray
       .method("unbound", &LogicalArray::unbound)
+      .method("offload_to", &LogicalArray::offload_to)
+      .method("slice",
+              [](const LogicalArray& a, int32_t dim, legate::Slice sl) {
+                return a.slice(dim, sl);
+              })
+      .method("_transpose",
+              [](const LogicalArray& a, std::vector<int32_t> axes) {
+                return a.transpose(std::move(axes));
+              })
+      .method("project",
+              [](const LogicalArray& a, int32_t dim, int64_t index) {
+                return a.project(dim, index);
+              })
+      .method("delinearize",
+              [](const LogicalArray& a, int32_t dim,
+                 std::vector<uint64_t> sizes) {
+                return a.delinearize(dim, std::move(sizes));
+              })
+      .method("_broadcast", &legate_wrapper::data::broadcast_array)
       .method("shape", [](const LogicalArray& arr) {
         auto s = arr.data().shape();
         std::vector<uint64_t> result;
@@ -244,6 +290,14 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
                                &AutoTask::add_input))
       .method("add_output", static_cast<Variable (AutoTask::*)(LogicalArray)>(
                                 &AutoTask::add_output))
+      .method("add_reduction",
+              [](AutoTask& t, LogicalArray a, legate::ReductionOpKind kind) {
+                return t.add_reduction(std::move(a), kind);
+              })
+      .method("add_reduction",
+              [](AutoTask& t, LogicalStore s, legate::ReductionOpKind kind) {
+                return t.add_reduction(std::move(s), kind);
+              })
       .method("add_scalar", static_cast<void (AutoTask::*)(const Scalar&)>(
                                 &AutoTask::add_scalar_arg))
       .method("add_constraint",
@@ -281,6 +335,13 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
               [](ManualTask& t, std::shared_ptr<LogicalStorePartition> p) {
                 t.add_output(*p);
               })
+      .method("add_reduction",
+              [](ManualTask& t, LogicalStore s, legate::ReductionOpKind kind) {
+                t.add_reduction(std::move(s), kind);
+              })
+      .method("add_reduction",
+              [](ManualTask& t, std::shared_ptr<LogicalStorePartition> p,
+                 legate::ReductionOpKind kind) { t.add_reduction(*p, kind); })
       .method("add_scalar", static_cast<void (ManualTask::*)(const Scalar&)>(
                                 &ManualTask::add_scalar_arg))
       .method("add_communicator",
@@ -345,6 +406,9 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
   mod.method("attach_external_store_fbmem",
              &legate_wrapper::data::attach_external_store_fbmem);
   mod.method("_get_ptr", &legate_wrapper::data::get_ptr);
+  mod.method("_element_strides", &legate_wrapper::data::element_strides);
+  mod.method("_read_scalar_store", &legate_wrapper::data::read_scalar_store);
+  mod.method("_issue_fill", &legate_wrapper::data::issue_fill);
   /* type management */
   mod.method("string_to_scalar", &legate_wrapper::data::string_to_scalar);
   /* timing */
@@ -354,6 +418,10 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
   /* hdf5 */
   mod.method("_read_h5", &legate_wrapper::hdf5::read_h5);
   mod.method("_write_h5", &legate_wrapper::hdf5::write_h5);
+
+  /* arrow */
+  mod.method("_import_arrow", &legate_wrapper::arrow::import_array);
+  mod.method("_export_arrow", &legate_wrapper::arrow::export_array);
   mod.method("num_procs", &legate_wrapper::runtime::num_procs);
   mod.method("num_gpus", &legate_wrapper::runtime::num_gpus);
   // `block` is required — do not default at the C++ binding layer.
@@ -363,4 +431,5 @@ JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
              &legate_wrapper::runtime::issue_mapping_fence);
 
   wrap_ufi(mod);
+  wrap_native(mod);
 }
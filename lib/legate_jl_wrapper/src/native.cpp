@@ -0,0 +1,121 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "native.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "checkpoint.h"
+#include "elementwise.h"
+#include "generator.h"
+#include "legate.h"
+#include "outofcore.h"
+#include "placement.h"
+#include "ready.h"
+#include "reduction.h"
+#include "scan.h"
+#include "sort.h"
+#include "sparse.h"
+#include "window.h"
+
+namespace native {
+
+legate::Library native_library() {
+  bool created = false;
+  auto library = legate::Runtime::get_runtime()->find_or_create_library(
+      "legate_jl_native", legate::ResourceConfig{}, nullptr, {}, &created);
+  if (created) {
+    register_reduction_tasks(library);
+    register_elementwise_tasks(library);
+    register_generator_tasks(library);
+    register_scan_tasks(library);
+    register_sort_tasks(library);
+    register_sparse_tasks(library);
+    register_placement_tasks(library);
+    register_window_tasks(library);
+    register_ready_tasks(library);
+    register_checkpoint_tasks(library);
+  }
+  return library;
+}
+
+std::uint64_t launch_tiles(std::uint64_t n) {
+  const auto procs = static_cast<std::uint64_t>(
+      legate::Runtime::get_runtime()->get_machine().count());
+  return std::max<std::uint64_t>(1, std::min(n, procs));
+}
+
+legate::ManualTask create_on_every_cpu(legate::LocalTaskID task_id) {
+  auto* runtime = legate::Runtime::get_runtime();
+  auto cpus = runtime->get_machine().only(legate::mapping::TaskTarget::CPU);
+  // The machine is captured when the task is created
+  legate::Scope scope{cpus};
+  const auto points = static_cast<legate::coord_t>(cpus.count());
+  return runtime->create_task(native_library(), task_id,
+                              legate::Domain{legate::Rect<1>{0, points - 1}});
+}
+
+}  // namespace native
+
+void wrap_native(jlcxx::Module& mod) {
+  mod.method("_native_library", &native::native_library);
+  mod.set_const("NATIVE_REDUCE_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::REDUCE_TASK});
+  mod.set_const("NATIVE_ARG_REDUCE_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::ARG_REDUCE_TASK});
+  mod.set_const("NATIVE_UNARY_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::UNARY_TASK});
+  mod.set_const("NATIVE_BINARY_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::BINARY_TASK});
+  mod.set_const("NATIVE_COMPARE_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::COMPARE_TASK});
+  mod.set_const("NATIVE_CAST_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::CAST_TASK});
+  mod.set_const("NATIVE_AXPY_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::AXPY_TASK});
+  mod.set_const("NATIVE_IOTA_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::IOTA_TASK});
+  mod.set_const("NATIVE_RANDOM_TASK",
+                legate::LocalTaskID{native::NativeTaskIDs::RANDOM_TASK});
+  mod.method("_inclusive_scan", &native::inclusive_scan);
+  mod.method("_sample_sort", &native::sample_sort);
+  mod.method("_csr_pos_from_rowptr", &native::csr_pos_from_rowptr);
+  mod.method("_spmv", &native::spmv);
+  mod.method("_prefetch", &native::prefetch);
+  mod.method("_prefetch", [](const legate::LogicalStore& store,
+                             legate::mapping::StoreTarget target) {
+    native::prefetch(legate::LogicalArray{store}, target);
+  });
+  mod.method("_map_file", &native::map_file);
+  mod.method("_unmap_file", &native::unmap_file);
+  mod.method("_attach_mapped", &native::attach_mapped);
+  mod.method("_tile_view", &native::tile_view);
+  mod.method("_advise_mapped", &native::advise_mapped);
+  mod.method("_issue_marker", &native::issue_marker);
+  mod.method("_completed_marker", &native::completed_marker);
+  mod.method("_watch", &native::watch);
+  mod.method("_watch", [](const legate::LogicalStore& store) {
+    return native::watch(legate::LogicalArray{store});
+  });
+  mod.method("_ticket_ready", &native::ticket_ready);
+  mod.method("_forget_ticket", &native::forget_ticket);
+  mod.method("_write_checkpoint", &native::write_checkpoint);
+  mod.method("_read_checkpoint", &native::read_checkpoint);
+}
@@ -0,0 +1,122 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "outofcore.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "legate.h"
+
+namespace native {
+
+namespace {
+
+[[noreturn]] void throw_errno(const std::string& what) {
+  throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+}  // namespace
+
+void* map_file(const std::string& path, std::size_t bytes, bool writable) {
+  if (bytes == 0) {
+    throw std::invalid_argument("cannot map an empty array");
+  }
+  const int fd = ::open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY,
+                        0644);
+  if (fd < 0) throw_errno("cannot open " + path);
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw_errno("cannot stat " + path);
+  }
+  if (static_cast<std::size_t>(st.st_size) < bytes) {
+    if (!writable) {
+      ::close(fd);
+      throw std::invalid_argument(path + " is smaller than the array");
+    }
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+      ::close(fd);
+      throw_errno("cannot resize " + path);
+    }
+  }
+
+  void* ptr = ::mmap(nullptr, bytes,
+                     writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                     fd, 0);
+  ::close(fd);  // the mapping keeps the file open
+  if (ptr == MAP_FAILED) throw_errno("cannot map " + path);
+  // Streaming pipelines walk tiles in order; let the kernel read ahead
+  ::madvise(ptr, bytes, MADV_SEQUENTIAL);
+  return ptr;
+}
+
+void unmap_file(void* ptr, std::size_t bytes) { ::munmap(ptr, bytes); }
+
+legate::LogicalArray attach_mapped(void* ptr, std::size_t bytes,
+                                   const legate::Shape& shape,
+                                   const legate::Type& type, bool writable) {
+  if (shape.volume() * type.size() > bytes) {
+    throw std::invalid_argument("mapping is smaller than the array");
+  }
+  auto alloc = legate::ExternalAllocation::create_sysmem(
+      ptr, bytes, !writable /*read_only*/,
+      [bytes](void* p) { ::munmap(p, bytes); });
+  auto store = legate::Runtime::get_runtime()->create_store(
+      shape, type, alloc, legate::mapping::DimOrdering::c_order());
+  return legate::LogicalArray{store};
+}
+
+legate::LogicalArray tile_view(const legate::LogicalArray& array,
+                               std::int64_t lo, std::int64_t hi) {
+  return legate::LogicalArray{array.data().slice(0, legate::Slice{lo, hi})};
+}
+
+void advise_mapped(void* ptr, std::size_t offset, std::size_t len,
+                   std::int32_t advice) {
+  const auto page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+  const auto base = reinterpret_cast<std::uintptr_t>(ptr);
+  const std::uintptr_t lo = (base + offset) / page * page;
+  const std::uintptr_t hi = (base + offset + len + page - 1) / page * page;
+  auto* start = reinterpret_cast<void*>(lo);
+  const std::size_t span = hi - lo;
+
+  switch (static_cast<TileAdvice>(advice)) {
+    case TileAdvice::WILLNEED:
+      ::madvise(start, span, MADV_WILLNEED);
+      return;
+    case TileAdvice::EVICT:
+      // Dirty pages of a shared mapping must reach the file before the
+      // kernel may drop them
+      ::msync(start, span, MS_SYNC);
+      ::madvise(start, span, MADV_DONTNEED);
+      return;
+  }
+  throw std::invalid_argument("unknown tile advice");
+}
+
+}  // namespace native
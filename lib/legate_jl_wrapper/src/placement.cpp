@@ -0,0 +1,84 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "placement.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "legate.h"
+
+namespace native {
+
+namespace {
+
+// Processors whose tasks the default mapper places in `target`
+legate::mapping::TaskTarget owner_of(legate::mapping::StoreTarget target) {
+  switch (target) {
+    case legate::mapping::StoreTarget::SYSMEM:
+      return legate::mapping::TaskTarget::CPU;
+    case legate::mapping::StoreTarget::SOCKETMEM:
+#if defined(LEGATE_JL_OPENMP)
+      return legate::mapping::TaskTarget::OMP;
+#else
+      throw std::invalid_argument(
+          "prefetching to SOCKETMEM needs a build with OpenMP support");
+#endif
+    case legate::mapping::StoreTarget::FBMEM:
+      return legate::mapping::TaskTarget::GPU;
+    case legate::mapping::StoreTarget::ZCMEM:
+      // GPU tasks get their data in FBMEM, so no task reads it into ZCMEM
+      throw std::invalid_argument(
+          "prefetching to ZCMEM is not supported, use FBMEM or SYSMEM");
+  }
+  throw std::invalid_argument("unknown store target");
+}
+
+}  // namespace
+
+/*static*/ void TouchTask::cpu_variant(legate::TaskContext /*context*/) {}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void TouchTask::omp_variant(legate::TaskContext /*context*/) {}
+#endif
+
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+/*static*/ void TouchTask::gpu_variant(legate::TaskContext /*context*/) {}
+#endif
+
+void register_placement_tasks(legate::Library& library) {
+  TouchTask::register_variants(library);
+}
+
+void prefetch(const legate::LogicalArray& array,
+              legate::mapping::StoreTarget target) {
+  auto* runtime = legate::Runtime::get_runtime();
+  auto machine = runtime->get_machine().only(owner_of(target));
+  if (machine.empty()) {
+    throw std::invalid_argument(
+        "no processors in the current machine can access the target memory");
+  }
+  legate::Scope scope{machine};
+  auto task =
+      runtime->create_task(native_library(), legate::LocalTaskID{TOUCH_TASK});
+  task.add_input(array);
+  runtime->submit(std::move(task));
+}
+
+}  // namespace native
@@ -0,0 +1,122 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "ready.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "legate.h"
+
+namespace native {
+
+namespace {
+
+std::atomic<std::uint64_t> next_ticket{0};
+std::mutex ready_mutex;
+std::unordered_set<std::uint64_t> ready_tickets;
+// Notify points of a ticket that ran in this process, until the last one does
+std::unordered_map<std::uint64_t, std::uint32_t> notified_points;
+// Tickets dropped before every local notify point ran. The points still to
+// come must not mark them ready again, or nothing would ever erase them.
+std::unordered_set<std::uint64_t> forgotten_tickets;
+
+void count_point(legate::TaskContext context) {
+  auto counter = context.reduction(0).data();
+  counter.reduce_accessor<legate::SumReduction<std::int32_t>, true, 1>().reduce(
+      counter.shape<1>().lo, 1);
+}
+
+}  // namespace
+
+/*static*/ void ReadyTask::cpu_variant(legate::TaskContext context) {
+  count_point(context);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void ReadyTask::omp_variant(legate::TaskContext context) {
+  count_point(context);
+}
+#endif
+
+/*static*/ void NotifyTask::cpu_variant(legate::TaskContext context) {
+  const auto ticket = context.scalar(0).value<std::uint64_t>();
+  const auto local_points = context.scalar(1).value<std::uint32_t>();
+  std::lock_guard<std::mutex> lock{ready_mutex};
+  const bool last = ++notified_points[ticket] >= local_points;
+  if (last) notified_points.erase(ticket);
+  if (forgotten_tickets.count(ticket) != 0) {
+    if (last) forgotten_tickets.erase(ticket);
+    return;
+  }
+  ready_tickets.insert(ticket);
+}
+
+void register_ready_tasks(legate::Library& library) {
+  ReadyTask::register_variants(library);
+  NotifyTask::register_variants(library);
+}
+
+std::uint64_t watch(const legate::LogicalArray& array) {
+  if (array.unbound()) {
+    throw std::invalid_argument("cannot wait on an unbound array");
+  }
+  auto* runtime = legate::Runtime::get_runtime();
+  auto library = native_library();
+  const auto ticket = next_ticket.fetch_add(1) + 1;
+
+  auto counter = runtime->create_store(legate::Scalar{std::int32_t{0}});
+  auto ready = runtime->create_task(library, legate::LocalTaskID{READY_TASK});
+  ready.add_input(array);
+  ready.add_reduction(counter, legate::ReductionOpKind::ADD);
+  runtime->submit(std::move(ready));
+
+  // Tickets are polled per process, so every rank runs a point. One point per
+  // CPU puts as many points on each rank as it has CPUs.
+  auto notify = create_on_every_cpu(legate::LocalTaskID{NOTIFY_TASK});
+  const std::uint32_t local_points = runtime->get_machine()
+                                         .only(legate::mapping::TaskTarget::CPU)
+                                         .processor_range()
+                                         .per_node_count;
+  notify.add_input(counter);
+  notify.add_scalar_arg(legate::Scalar{ticket});
+  notify.add_scalar_arg(legate::Scalar{local_points});
+  runtime->submit(std::move(notify));
+  return ticket;
+}
+
+bool ticket_ready(std::uint64_t ticket) {
+  std::lock_guard<std::mutex> lock{ready_mutex};
+  return ready_tickets.count(ticket) != 0;
+}
+
+void forget_ticket(std::uint64_t ticket) {
+  std::lock_guard<std::mutex> lock{ready_mutex};
+  const bool was_ready = ready_tickets.erase(ticket) != 0;
+  if (!was_ready || notified_points.count(ticket) != 0) {
+    forgotten_tickets.insert(ticket);
+  }
+}
+
+}  // namespace native
@@ -0,0 +1,259 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "reduction.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+template <typename T>
+struct SumSqOp {
+  using Acc = double;
+  static Acc identity() { return 0.0; }
+  static Acc fold(Acc a, T x) {
+    const auto v = static_cast<double>(x);
+    return a + v * v;
+  }
+  static Acc combine(Acc a, Acc b) { return a + b; }
+};
+
+// Independent accumulator lanes let the compiler vectorize the loop without
+// having to reassociate floating-point operations.
+template <typename Op, typename T>
+typename Op::Acc fold_dense(const T* ptr, std::size_t n) {
+  constexpr std::size_t LANES = 8;
+  typename Op::Acc lanes[LANES];
+  for (auto& lane : lanes) lane = Op::identity();
+
+  std::size_t i = 0;
+  for (; i + LANES <= n; i += LANES) {
+    for (std::size_t j = 0; j < LANES; ++j) {
+      lanes[j] = Op::fold(lanes[j], ptr[i + j]);
+    }
+  }
+  for (; i < n; ++i) lanes[0] = Op::fold(lanes[0], ptr[i]);
+
+  auto acc = Op::identity();
+  for (auto lane : lanes) acc = Op::combine(acc, lane);
+  return acc;
+}
+
+template <typename Op, typename T>
+typename Op::Acc fold_dense_parallel(const T* ptr, std::size_t n) {
+#if defined(LEGATE_JL_OPENMP)
+  const int nthreads = omp_get_max_threads();
+  std::vector<typename Op::Acc> partial(nthreads, Op::identity());
+#pragma omp parallel num_threads(nthreads)
+  {
+    const auto t = static_cast<std::size_t>(omp_get_thread_num());
+    const std::size_t chunk = (n + nthreads - 1) / nthreads;
+    const std::size_t lo = std::min(n, t * chunk);
+    const std::size_t hi = std::min(n, lo + chunk);
+    partial[t] = fold_dense<Op>(ptr + lo, hi - lo);
+  }
+  auto acc = Op::identity();
+  for (auto p : partial) acc = Op::combine(acc, p);
+  return acc;
+#else
+  return fold_dense<Op>(ptr, n);
+#endif
+}
+
+template <typename Op, typename T, int DIM>
+typename Op::Acc fold_tile(const legate::PhysicalStore& store, bool parallel) {
+  auto rect = store.shape<DIM>();
+  if (rect.empty()) return Op::identity();
+
+  auto acc = store.read_accessor<T, DIM>(rect);
+  if (acc.accessor.is_dense_row_major(rect)) {
+    const T* ptr = acc.ptr(rect.lo);
+    return parallel ? fold_dense_parallel<Op>(ptr, rect.volume())
+                    : fold_dense<Op>(ptr, rect.volume());
+  }
+  auto result = Op::identity();
+  for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it) {
+    result = Op::fold(result, acc[*it]);
+  }
+  return result;
+}
+
+template <typename Redop, typename Acc>
+void reduce_into(const legate::PhysicalStore& out, Acc value) {
+  out.reduce_accessor<Redop, true, 1>().reduce(out.shape<1>().lo, value);
+}
+
+struct ReduceFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(ReduceOp op, const legate::PhysicalStore& in,
+                  const legate::PhysicalStore& out, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "native reductions support integer and floating-point arrays");
+    } else {
+      switch (op) {
+        case ReduceOp::SUM:
+          reduce_into<legate::SumReduction<T>>(
+              out, fold_tile<SumOp<T>, T, DIM>(in, parallel));
+          return;
+        case ReduceOp::PROD:
+          reduce_into<legate::ProdReduction<T>>(
+              out, fold_tile<ProdOp<T>, T, DIM>(in, parallel));
+          return;
+        case ReduceOp::MIN:
+          reduce_into<legate::MinReduction<T>>(
+              out, fold_tile<MinOp<T>, T, DIM>(in, parallel));
+          return;
+        case ReduceOp::MAX:
+          reduce_into<legate::MaxReduction<T>>(
+              out, fold_tile<MaxOp<T>, T, DIM>(in, parallel));
+          return;
+        case ReduceOp::SUMSQ:
+          reduce_into<legate::SumReduction<double>>(
+              out, fold_tile<SumSqOp<T>, T, DIM>(in, parallel));
+          return;
+        default:
+          throw std::invalid_argument("unsupported native reduction");
+      }
+    }
+  }
+};
+
+void reduce(legate::TaskContext& context, bool parallel) {
+  auto in = context.input(0).data();
+  auto out = context.reduction(0).data();
+  auto op = static_cast<ReduceOp>(context.scalar(0).value<std::int32_t>());
+  legate::double_dispatch(in.dim(), in.type().code(), ReduceFunctor{}, op, in,
+                          out, parallel);
+}
+
+// Row-major coordinates of the element `offset` elements past `rect.lo`
+template <int DIM>
+legate::Point<DIM> unravel(const legate::Rect<DIM>& rect, std::size_t offset) {
+  legate::Point<DIM> p;
+  for (int d = DIM - 1; d >= 0; --d) {
+    const auto extent = static_cast<std::size_t>(rect.hi[d] - rect.lo[d] + 1);
+    p[d] = rect.lo[d] + static_cast<legate::coord_t>(offset % extent);
+    offset /= extent;
+  }
+  return p;
+}
+
+template <int DIM>
+bool lex_less(const legate::Point<DIM>& a, const legate::Point<DIM>& b) {
+  for (int d = 0; d < DIM; ++d) {
+    if (a[d] != b[d]) return a[d] < b[d];
+  }
+  return false;
+}
+
+struct ArgReduceFunctor {
+  template <legate::Type::Code CODE, int DIM>
+  void operator()(bool is_min, const legate::PhysicalStore& in,
+                  legate::PhysicalStore& values,
+                  legate::PhysicalStore& coords) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "native reductions support integer and floating-point arrays");
+    } else {
+      auto rect = in.shape<DIM>();
+      if (rect.empty()) {
+        values.bind_empty_data();
+        coords.bind_empty_data();
+        return;
+      }
+
+      auto better = [is_min](T a, T b) { return is_min ? a < b : a > b; };
+      auto acc = in.read_accessor<T, DIM>(rect);
+      T best = acc[rect.lo];
+      legate::Point<DIM> best_pt = rect.lo;
+
+      if (acc.accessor.is_dense_row_major(rect)) {
+        // Strict comparison keeps the first hit, i.e. the smallest index
+        const T* ptr = acc.ptr(rect.lo);
+        const std::size_t n = rect.volume();
+        std::size_t best_off = 0;
+        for (std::size_t i = 1; i < n; ++i) {
+          if (better(ptr[i], best)) {
+            best = ptr[i];
+            best_off = i;
+          }
+        }
+        best_pt = unravel(rect, best_off);
+      } else {
+        for (legate::PointInRectIterator<DIM> it(rect); it.valid(); ++it) {
+          const T v = acc[*it];
+          if (better(v, best) || (v == best && lex_less(*it, best_pt))) {
+            best = v;
+            best_pt = *it;
+          }
+        }
+      }
+
+      auto vbuf = values.create_output_buffer<T, 1>(legate::Point<1>(1),
+                                                    true /*bind_buffer*/);
+      vbuf[legate::Point<1>(0)] = best;
+      auto cbuf = coords.create_output_buffer<std::int64_t, 1>(
+          legate::Point<1>(DIM), true /*bind_buffer*/);
+      for (int d = 0; d < DIM; ++d) cbuf[legate::Point<1>(d)] = best_pt[d];
+    }
+  }
+};
+
+}  // namespace
+
+/*static*/ void ReduceTask::cpu_variant(legate::TaskContext context) {
+  reduce(context, false);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void ReduceTask::omp_variant(legate::TaskContext context) {
+  reduce(context, true);
+}
+#endif
+
+/*static*/ void ArgReduceTask::cpu_variant(legate::TaskContext context) {
+  auto in = context.input(0).data();
+  auto values = context.output(0).data();
+  auto coords = context.output(1).data();
+  auto op = static_cast<ReduceOp>(context.scalar(0).value<std::int32_t>());
+  if (op != ReduceOp::ARGMIN && op != ReduceOp::ARGMAX) {
+    throw std::invalid_argument("ArgReduceTask expects ARGMIN or ARGMAX");
+  }
+  legate::double_dispatch(in.dim(), in.type().code(), ArgReduceFunctor{},
+                          op == ReduceOp::ARGMIN, in, values, coords);
+}
+
+void register_reduction_tasks(legate::Library& library) {
+  ReduceTask::register_variants(library);
+  ArgReduceTask::register_variants(library);
+}
+
+}  // namespace native
@@ -0,0 +1,169 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "scan.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "kernels.h"
+#include "legate.h"
+#include "reduction.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+template <typename T, typename F>
+void with_scan_op(ReduceOp op, F&& f) {
+  switch (op) {
+    case ReduceOp::SUM:
+      return f(SumOp<T>{});
+    case ReduceOp::PROD:
+      return f(ProdOp<T>{});
+    case ReduceOp::MIN:
+      return f(MinOp<T>{});
+    case ReduceOp::MAX:
+      return f(MaxOp<T>{});
+    default:
+      throw std::invalid_argument("scans support sum, prod, min and max");
+  }
+}
+
+struct ScanLocalFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(ReduceOp op, const legate::PhysicalStore& in,
+                  const legate::PhysicalStore& out,
+                  const legate::PhysicalStore& totals) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "scans support integer and floating-point arrays");
+    } else {
+      with_scan_op<T>(op, [&](auto scan_op) {
+        using Op = decltype(scan_op);
+        auto rect = in.shape<1>();
+        auto r = in.read_accessor<T, 1>(rect);
+        auto w = out.write_accessor<T, 1>(rect);
+        T acc = Op::identity();
+        for (legate::coord_t i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+          acc = Op::fold(acc, r[i]);
+          w[i] = acc;
+        }
+        totals.write_accessor<T, 1>()[totals.shape<1>().lo] = acc;
+      });
+    }
+  }
+};
+
+struct ScanFixupFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(ReduceOp op, legate::coord_t color,
+                  const legate::PhysicalStore& totals,
+                  const legate::PhysicalStore& out) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "scans support integer and floating-point arrays");
+    } else {
+      with_scan_op<T>(op, [&](auto scan_op) {
+        using Op = decltype(scan_op);
+        auto t = totals.read_accessor<T, 1>();
+        T prefix = Op::identity();
+        for (legate::coord_t c = 0; c < color; ++c) {
+          prefix = Op::combine(prefix, t[c]);
+        }
+        auto rect = out.shape<1>();
+        auto rw = out.read_write_accessor<T, 1>(rect);
+        for (legate::coord_t i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+          rw[i] = Op::combine(prefix, rw[i]);
+        }
+      });
+    }
+  }
+};
+
+}  // namespace
+
+/*static*/ void ScanLocalTask::cpu_variant(legate::TaskContext context) {
+  auto in = context.input(0).data();
+  auto out = context.output(0).data();
+  auto totals = context.output(1).data();
+  auto op = static_cast<ReduceOp>(context.scalar(0).value<std::int32_t>());
+  legate::type_dispatch(in.type().code(), ScanLocalFunctor{}, op, in, out,
+                        totals);
+}
+
+/*static*/ void ScanFixupTask::cpu_variant(legate::TaskContext context) {
+  auto color = context.get_task_index()[0];
+  if (color == 0) return;  // nothing precedes the first tile
+  auto totals = context.input(0).data();
+  auto out = context.output(0).data();
+  auto op = static_cast<ReduceOp>(context.scalar(0).value<std::int32_t>());
+  legate::type_dispatch(out.type().code(), ScanFixupFunctor{}, op, color,
+                        totals, out);
+}
+
+void register_scan_tasks(legate::Library& library) {
+  ScanLocalTask::register_variants(library);
+  ScanFixupTask::register_variants(library);
+}
+
+void inclusive_scan(const legate::LogicalArray& in,
+                    const legate::LogicalArray& out, std::int32_t op) {
+  auto input = in.data();
+  auto output = out.data();
+  if (input.dim() != 1 || output.dim() != 1) {
+    throw std::invalid_argument("scans expect 1-D arrays");
+  }
+  const std::uint64_t n = input.volume();
+  if (n == 0) return;
+
+  auto* runtime = legate::Runtime::get_runtime();
+  auto library = native_library();
+  const std::uint64_t tiles = launch_tiles(n);
+  const std::uint64_t tile = (n + tiles - 1) / tiles;
+  const std::uint64_t colors = (n + tile - 1) / tile;
+  const legate::Domain launch{
+      legate::Rect<1>{0, static_cast<legate::coord_t>(colors) - 1}};
+
+  auto totals = runtime->create_store(legate::Shape{colors}, input.type());
+  auto out_tiles = output.partition_by_tiling({tile});
+
+  auto local = runtime->create_task(
+      library, legate::LocalTaskID{SCAN_LOCAL_TASK}, launch);
+  local.add_input(input.partition_by_tiling({tile}));
+  local.add_output(out_tiles);
+  local.add_output(totals.partition_by_tiling({1}));
+  local.add_scalar_arg(legate::Scalar{op});
+  runtime->submit(std::move(local));
+
+  // Every tile reads all the totals; there is one per tile, so this is cheap
+  auto fixup = runtime->create_task(
+      library, legate::LocalTaskID{SCAN_FIXUP_TASK}, launch);
+  fixup.add_input(totals);
+  fixup.add_input(out_tiles);
+  fixup.add_output(out_tiles);
+  fixup.add_scalar_arg(legate::Scalar{op});
+  runtime->submit(std::move(fixup));
+}
+
+}  // namespace native
@@ -0,0 +1,381 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+// Strict weak order matching Julia's isless: NaNs sort after every other
+// value (and compare equal to each other), and -0.0 sorts before 0.0. A plain
+// operator< is not a strict weak order once NaNs are present.
+template <typename T>
+bool total_less(const T& a, const T& b) {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(a)) return false;
+    if (std::isnan(b)) return true;
+    if (a == b) return std::signbit(a) && !std::signbit(b);
+  }
+  return a < b;
+}
+
+template <typename T>
+std::vector<T> read_all(const legate::PhysicalStore& store) {
+  auto rect = store.shape<1>();
+  std::vector<T> result;
+  if (rect.empty()) return result;
+  auto r = store.read_accessor<T, 1>(rect);
+  result.reserve(rect.volume());
+  for (legate::coord_t i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+    result.push_back(r[i]);
+  }
+  return result;
+}
+
+template <typename T>
+void write_all(const legate::PhysicalStore& store, const std::vector<T>& src) {
+  auto rect = store.shape<1>();
+  auto w = store.write_accessor<T, 1>(rect);
+  for (std::size_t k = 0; k < src.size(); ++k) {
+    w[rect.lo[0] + static_cast<legate::coord_t>(k)] = src[k];
+  }
+}
+
+// `count` regularly spaced elements of the sorted vector `v`
+template <typename T>
+std::vector<T> regular_samples(const std::vector<T>& v, std::size_t count) {
+  std::vector<T> samples(count);
+  for (std::size_t k = 0; k < count; ++k) {
+    const std::size_t pos = (k + 1) * v.size() / (count + 1);
+    samples[k] = v[std::min(pos, v.size() - 1)];
+  }
+  return samples;
+}
+
+template <typename T>
+void bind_output(const legate::PhysicalStore& store,
+                 const std::vector<T>& src) {
+  if (src.empty()) {
+    store.bind_empty_data();
+    return;
+  }
+  auto buf = store.create_output_buffer<T, 1>(
+      legate::Point<1>(static_cast<legate::coord_t>(src.size())),
+      true /*bind_buffer*/);
+  std::copy(src.begin(), src.end(), buf.ptr(legate::Point<1>(0)));
+}
+
+// Sorts (value, source index) pairs by value, keeping equal values in the
+// order they were appended
+template <typename It>
+void stable_sort_by_value(It first, It last) {
+  std::stable_sort(first, last, [](const auto& a, const auto& b) {
+    return total_less(a.first, b.first);
+  });
+}
+
+struct SampleFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(legate::TaskContext& context, const legate::PhysicalStore& in,
+                  std::int64_t index_base) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "sort supports integer and floating-point arrays");
+    } else {
+      auto rect = in.shape<1>();
+      std::vector<std::pair<T, std::int64_t>> items;
+      if (!rect.empty()) {
+        auto r = in.read_accessor<T, 1>(rect);
+        items.reserve(rect.volume());
+        for (legate::coord_t i = rect.lo[0]; i <= rect.hi[0]; ++i) {
+          items.emplace_back(r[i], i + index_base);
+        }
+      }
+      stable_sort_by_value(items.begin(), items.end());
+
+      std::vector<T> sorted(items.size());
+      std::vector<std::int64_t> source(items.size());
+      for (std::size_t k = 0; k < items.size(); ++k) {
+        sorted[k] = items[k].first;
+        source[k] = items[k].second;
+      }
+      write_all(context.output(0).data(), sorted);
+      write_all(context.output(1).data(), source);
+      if (context.num_outputs() > 2) {
+        auto samples = context.output(2).data();
+        write_all(samples,
+                  regular_samples(sorted, samples.shape<1>().volume()));
+      }
+    }
+  }
+};
+
+struct SplittersFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(const legate::PhysicalStore& samples,
+                  const legate::PhysicalStore& splitters) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "sort supports integer and floating-point arrays");
+    } else {
+      auto all = read_all<T>(samples);
+      std::sort(all.begin(), all.end(), total_less<T>);
+      write_all(splitters,
+                regular_samples(all, splitters.shape<1>().volume()));
+    }
+  }
+};
+
+struct RangesFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(legate::TaskContext& context,
+                  const legate::PhysicalStore& staged,
+                  const legate::PhysicalStore& ranges) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "sort supports integer and floating-point arrays");
+    } else {
+      std::vector<T> splitters;
+      if (context.num_inputs() > 1) {
+        splitters = read_all<T>(context.input(1).data());
+      }
+      const auto values = read_all<T>(staged);
+      const legate::coord_t base = staged.shape<1>().lo[0];
+      // Position of the first value of the sorted tile not below `v`
+      auto first_from = [&](const T& v) {
+        return static_cast<legate::coord_t>(
+            std::lower_bound(values.begin(), values.end(), v, total_less<T>) -
+            values.begin());
+      };
+
+      auto column = ranges.shape<2>();
+      auto w = ranges.write_accessor<legate::Rect<1>, 2>(column);
+      const legate::coord_t buckets = column.hi[0] + 1;
+      const legate::coord_t tile = column.lo[1];
+      for (legate::coord_t b = 0; b < buckets; ++b) {
+        const legate::coord_t lo = b == 0 ? 0 : first_from(splitters[b - 1]);
+        const legate::coord_t hi =
+            b == buckets - 1 ? static_cast<legate::coord_t>(values.size())
+                             : first_from(splitters[b]);
+        // an empty run gets hi < lo, which iterates zero times
+        w[legate::Point<2>{b, tile}] =
+            legate::Rect<1>{base + lo, base + hi - 1};
+      }
+    }
+  }
+};
+
+struct BucketFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(const legate::PhysicalStore& ranges,
+                  const legate::PhysicalStore& staged,
+                  const legate::PhysicalStore& staged_indices,
+                  const legate::PhysicalStore& values,
+                  const legate::PhysicalStore& indices) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "sort supports integer and floating-point arrays");
+    } else {
+      std::vector<std::pair<T, std::int64_t>> items;
+      auto rows = ranges.shape<2>();
+      if (!rows.empty()) {
+        auto rr = ranges.read_accessor<legate::Rect<1>, 2>(rows);
+        auto vr = staged.read_accessor<T, 1>();
+        auto ir = staged_indices.read_accessor<std::int64_t, 1>();
+        for (legate::coord_t b = rows.lo[0]; b <= rows.hi[0]; ++b) {
+          const std::size_t first = items.size();
+          // Runs come in tile order and each is sorted stably, so a stable
+          // merge keeps equal keys in their original order
+          for (legate::coord_t t = rows.lo[1]; t <= rows.hi[1]; ++t) {
+            const legate::Rect<1> run = rr[legate::Point<2>{b, t}];
+            for (legate::coord_t j = run.lo[0]; j <= run.hi[0]; ++j) {
+              items.emplace_back(vr[j], ir[j]);
+            }
+          }
+          stable_sort_by_value(items.begin() + first, items.end());
+        }
+      }
+
+      std::vector<T> sorted(items.size());
+      std::vector<std::int64_t> source(items.size());
+      for (std::size_t k = 0; k < items.size(); ++k) {
+        sorted[k] = items[k].first;
+        source[k] = items[k].second;
+      }
+      bind_output(values, sorted);
+      bind_output(indices, source);
+    }
+  }
+};
+
+}  // namespace
+
+/*static*/ void SortSampleTask::cpu_variant(legate::TaskContext context) {
+  auto in = context.input(0).data();
+  auto index_base = context.scalar(0).value<std::int64_t>();
+  legate::type_dispatch(in.type().code(), SampleFunctor{}, context, in,
+                        index_base);
+}
+
+/*static*/ void SortSplittersTask::cpu_variant(legate::TaskContext context) {
+  auto samples = context.input(0).data();
+  auto splitters = context.output(0).data();
+  legate::type_dispatch(samples.type().code(), SplittersFunctor{}, samples,
+                        splitters);
+}
+
+/*static*/ void SortRangesTask::cpu_variant(legate::TaskContext context) {
+  auto staged = context.input(0).data();
+  auto ranges = context.output(0).data();
+  legate::type_dispatch(staged.type().code(), RangesFunctor{}, context, staged,
+                        ranges);
+}
+
+/*static*/ void SortBucketTask::cpu_variant(legate::TaskContext context) {
+  // launched without inputs when there is nothing to sort
+  if (context.num_inputs() == 0) {
+    context.output(0).data().bind_empty_data();
+    context.output(1).data().bind_empty_data();
+    return;
+  }
+  auto ranges = context.input(0).data();
+  auto staged = context.input(1).data();
+  auto staged_indices = context.input(2).data();
+  auto values = context.output(0).data();
+  auto indices = context.output(1).data();
+  legate::type_dispatch(staged.type().code(), BucketFunctor{}, ranges, staged,
+                        staged_indices, values, indices);
+}
+
+void register_sort_tasks(legate::Library& library) {
+  SortSampleTask::register_variants(library);
+  SortSplittersTask::register_variants(library);
+  SortRangesTask::register_variants(library);
+  SortBucketTask::register_variants(library);
+}
+
+void sample_sort(const legate::LogicalArray& in,
+                 const legate::LogicalArray& values,
+                 const legate::LogicalArray& indices, std::int64_t index_base) {
+  auto input = in.data();
+  if (input.dim() != 1) {
+    throw std::invalid_argument("sort expects a 1-D array");
+  }
+  auto* runtime = legate::Runtime::get_runtime();
+  auto library = native_library();
+  const std::uint64_t n = input.volume();
+  if (n == 0) {
+    // There are no tiles to launch over; a lone bucket task binds both
+    // outputs empty
+    auto bucket = runtime->create_task(library,
+                                       legate::LocalTaskID{SORT_BUCKET_TASK});
+    bucket.add_output(values.data());
+    bucket.add_output(indices.data());
+    runtime->submit(std::move(bucket));
+    return;
+  }
+  const std::uint64_t tiles = launch_tiles(n);
+  const std::uint64_t tile =
+      std::max<std::uint64_t>(1, (n + tiles - 1) / tiles);
+  const std::uint64_t buckets =
+      std::max<std::uint64_t>(1, (n + tile - 1) / tile);
+  const legate::Domain launch{
+      legate::Rect<1>{0, static_cast<legate::coord_t>(buckets) - 1}};
+
+  // Every tile sorts itself into the staging stores and, with more than one
+  // bucket, samples itself for the splitters
+  auto staged = runtime->create_store(legate::Shape{n}, input.type());
+  auto staged_indices =
+      runtime->create_store(legate::Shape{n}, legate::int64());
+  auto sample = runtime->create_task(
+      library, legate::LocalTaskID{SORT_SAMPLE_TASK}, launch);
+  sample.add_input(input.partition_by_tiling({tile}));
+  sample.add_output(staged.partition_by_tiling({tile}));
+  sample.add_output(staged_indices.partition_by_tiling({tile}));
+  sample.add_scalar_arg(legate::Scalar{index_base});
+
+  std::optional<legate::LogicalStore> splitters;
+  if (buckets > 1) {
+    const std::uint64_t per_tile = buckets - 1;
+    auto samples =
+        runtime->create_store(legate::Shape{buckets * per_tile}, input.type());
+    sample.add_output(samples.partition_by_tiling({per_tile}));
+    runtime->submit(std::move(sample));
+
+    splitters = runtime->create_store(legate::Shape{per_tile}, input.type());
+    auto pick = runtime->create_task(
+        library, legate::LocalTaskID{SORT_SPLITTERS_TASK},
+        legate::Domain{legate::Rect<1>{0, 0}});
+    pick.add_input(samples);
+    pick.add_output(*splitters);
+    runtime->submit(std::move(pick));
+  } else {
+    runtime->submit(std::move(sample));
+  }
+
+  // ranges[b, t] is the run of sorted tile t that falls in bucket b. Tile t
+  // fills column t, so the launch point t maps to color (0, t).
+  auto ranges = runtime->create_store(legate::Shape{buckets, buckets},
+                                      legate::rect_type(1));
+  auto split = runtime->create_task(
+      library, legate::LocalTaskID{SORT_RANGES_TASK}, launch);
+  split.add_input(staged.partition_by_tiling({tile}));
+  if (splitters.has_value()) split.add_input(*splitters);
+  split.add_output(ranges.partition_by_tiling({buckets, 1}),
+                   legate::SymbolicPoint{legate::constant(0),
+                                         legate::dimension(0)});
+  runtime->submit(std::move(split));
+
+  // Each point takes whole rows of `ranges`, and the image constraints hand
+  // it only the runs of its buckets, so every key moves to exactly one
+  // processor
+  auto bucket = runtime->create_task(library,
+                                     legate::LocalTaskID{SORT_BUCKET_TASK});
+  auto vranges = bucket.add_input(ranges);
+  auto vstaged = bucket.add_input(staged);
+  auto vstaged_indices = bucket.add_input(staged_indices);
+  bucket.add_output(values.data());
+  bucket.add_output(indices.data());
+  const std::uint32_t tile_axis[] = {1};
+  bucket.add_constraint(legate::broadcast(
+      vranges, legate::Span<const std::uint32_t>{tile_axis, 1}));
+  bucket.add_constraint(legate::image(vranges, vstaged));
+  bucket.add_constraint(legate::image(vranges, vstaged_indices));
+  runtime->submit(std::move(bucket));
+}
+
+}  // namespace native
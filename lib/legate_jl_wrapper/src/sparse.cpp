@@ -0,0 +1,131 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "sparse.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "kernels.h"
+#include "legate.h"
+#include "types.h"
+
+namespace native {
+
+namespace {
+
+struct SpMVFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(const legate::PhysicalStore& y,
+                  const legate::PhysicalStore& pos,
+                  const legate::PhysicalStore& crd,
+                  const legate::PhysicalStore& vals,
+                  const legate::PhysicalStore& x, bool parallel) {
+    using T = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (!is_numeric_v<T>) {
+      throw std::invalid_argument(
+          "spmv supports integer and floating-point matrices");
+    } else {
+      auto rows = y.shape<1>();
+      if (rows.empty()) return;
+      auto yw = y.write_accessor<T, 1>(rows);
+      auto pr = pos.read_accessor<legate::Rect<1>, 1>();
+      auto cr = crd.read_accessor<std::int64_t, 1>();
+      auto vr = vals.read_accessor<T, 1>();
+      auto xr = x.read_accessor<T, 1>();
+      parallel_for(rows.volume(), parallel, [&](std::size_t k) {
+        const auto row = rows.lo[0] + static_cast<legate::coord_t>(k);
+        const legate::Rect<1> range = pr[row];
+        T sum{0};
+        for (legate::coord_t j = range.lo[0]; j <= range.hi[0]; ++j) {
+          sum += vr[j] * xr[cr[j]];
+        }
+        yw[row] = sum;
+      });
+    }
+  }
+};
+
+void spmv_kernel(legate::TaskContext& context, bool parallel) {
+  auto y = context.output(0).data();
+  auto pos = context.input(0).data();
+  auto crd = context.input(1).data();
+  auto vals = context.input(2).data();
+  auto x = context.input(3).data();
+  legate::type_dispatch(vals.type().code(), SpMVFunctor{}, y, pos, crd, vals,
+                        x, parallel);
+}
+
+}  // namespace
+
+/*static*/ void SpMVTask::cpu_variant(legate::TaskContext context) {
+  spmv_kernel(context, false);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void SpMVTask::omp_variant(legate::TaskContext context) {
+  spmv_kernel(context, true);
+}
+#endif
+
+void register_sparse_tasks(legate::Library& library) {
+  SpMVTask::register_variants(library);
+}
+
+legate::LogicalStore csr_pos_from_rowptr(
+    const std::vector<std::int64_t>& rowptr) {
+  if (rowptr.empty()) {
+    throw std::invalid_argument("rowptr must have rows + 1 entries");
+  }
+  const std::uint64_t rows = rowptr.size() - 1;
+  auto pos = legate::Runtime::get_runtime()->create_store(
+      legate::Shape{rows}, legate::rect_type(1));
+  if (rows == 0) return pos;
+
+  auto phys = pos.get_physical_store();
+  auto w = phys.write_accessor<legate::Rect<1>, 1>();
+  for (std::uint64_t i = 0; i < rows; ++i) {
+    // empty rows get hi < lo, which iterates zero times
+    w[static_cast<legate::coord_t>(i)] =
+        legate::Rect<1>{rowptr[i], rowptr[i + 1] - 1};
+  }
+  return pos;
+}
+
+void spmv(const legate::LogicalStore& pos, const legate::LogicalStore& crd,
+          const legate::LogicalStore& vals, const legate::LogicalStore& x,
+          const legate::LogicalStore& y) {
+  auto* runtime = legate::Runtime::get_runtime();
+  auto task = runtime->create_task(native_library(),
+                                   legate::LocalTaskID{SPMV_TASK});
+  auto vy = task.add_output(y);
+  auto vpos = task.add_input(pos);
+  auto vcrd = task.add_input(crd);
+  auto vvals = task.add_input(vals);
+  auto vx = task.add_input(x);
+  task.add_constraint(legate::align(vy, vpos));
+  task.add_constraint(legate::image(vpos, vcrd));
+  task.add_constraint(legate::image(vpos, vvals));
+  task.add_constraint(legate::image(vcrd, vx));
+  runtime->submit(std::move(task));
+}
+
+}  // namespace native
@@ -2,18 +2,34 @@
 
 #include <uv.h>  // For uv_async_send
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <mutex>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "legate.h"
+#include "legate/comm/coll.h"
 #include "types.h"
 
+#if defined(LEGATE_JL_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 //#define DEBUG
 #ifdef DEBUG
 #define DEBUG_PRINT(...)                  \
@@ -55,6 +71,15 @@ struct ufiFunctor {
   ufiFunctor() = default;
   ufiFunctor(int* ndim, int64_t* dims) : ndim_ptr(ndim), dims_ptr(dims) {}
 
+  // Takes the launch shape from `domain` unless an earlier argument set it
+  void record(const legate::Domain& domain) {
+    if (!ndim_ptr || *ndim_ptr != 0) return;
+    *ndim_ptr = domain.get_dim();
+    for (int i = 0; i < *ndim_ptr && i < 3; ++i) {
+      dims_ptr[i] = domain.hi()[i] - domain.lo()[i] + 1;
+    }
+  }
+
   template <legate::Type::Code CODE, int DIM>
   void operator()(ufi::AccessMode mode, std::uintptr_t& p,
                   const legate::PhysicalArray& rf) {
@@ -74,6 +99,214 @@ struct ufiFunctor {
   }
 };
 
+// Element type of an array argument beyond its code: the uid lets Julia map
+// STRUCT/FIXED_ARRAY/BINARY types back to the Julia type they were made from.
+struct ArgTypeInfo {
+  uint32_t uid;
+  uint32_t size;  // bytes per element, 0 for variable-size types
+};
+
+// A STRING or LIST argument: inclusive ranges into a flat payload, both read
+// in place. Element i spans payload[ranges[i].lo - data_lo, ranges[i].hi -
+// data_lo]. Matches VarSizeView in ufi.jl.
+struct VarSizeView {
+  const void* ranges;  // legate::Rect<1> per element
+  const void* data;
+  int64_t length;
+  int64_t data_lo;
+  int64_t data_length;
+  int data_type;
+  uint32_t data_uid;
+  uint32_t data_size;
+};
+
+inline bool is_var_size(legate::Type::Code code) {
+  return code == legate::Type::Code::STRING || code == legate::Type::Code::LIST;
+}
+
+inline bool is_fixed_compound(legate::Type::Code code) {
+  return code == legate::Type::Code::STRUCT ||
+         code == legate::Type::Code::FIXED_ARRAY ||
+         code == legate::Type::Code::BINARY;
+}
+
+inline ArgTypeInfo type_info(const legate::Type& type) {
+  return ArgTypeInfo{type.uid(), is_var_size(type.code())
+                                     ? 0u
+                                     : static_cast<uint32_t>(type.size())};
+}
+
+inline VarSizeView var_size_view(const legate::PhysicalArray& array) {
+  const bool is_string = array.type().code() == legate::Type::Code::STRING;
+  auto descriptor = is_string ? array.as_string_array().ranges()
+                              : array.as_list_array().descriptor();
+  auto vardata = is_string ? array.as_string_array().chars()
+                           : array.as_list_array().vardata();
+  if (vardata.nested() || is_var_size(vardata.type().code())) {
+    throw std::invalid_argument("nested LIST arrays are not supported");
+  }
+  auto ranges = descriptor.data();
+  auto payload = vardata.data();
+  const auto rect = ranges.shape<1>();
+  const auto payload_rect = payload.shape<1>();
+  const auto info = type_info(payload.type());
+
+  VarSizeView view{};
+  view.length = static_cast<int64_t>(rect.volume());
+  view.ranges =
+      rect.empty()
+          ? nullptr
+          : ranges.read_accessor<legate::Rect<1>, 1, false>().ptr(rect.lo);
+  view.data = payload_rect.empty() ? nullptr
+                                   : payload.get_inline_allocation().ptr;
+  view.data_lo = payload_rect.lo[0];
+  view.data_length = static_cast<int64_t>(payload_rect.volume());
+  view.data_type = static_cast<int>(payload.type().code());
+  view.data_uid = info.uid;
+  view.data_size = info.size;
+  return view;
+}
+
+// Pointer handed to Julia for an array argument: its first element, or for
+// STRING/LIST inputs a VarSizeView appended to `views`. `views` must not
+// reallocate while the task runs.
+inline void* argument_ptr(ufi::AccessMode mode,
+                          const legate::PhysicalArray& array,
+                          ufiFunctor& functor,
+                          std::vector<VarSizeView>& views) {
+  const auto code = array.type().code();
+  if (is_var_size(code)) {
+    if (mode != ufi::AccessMode::READ) {
+      throw std::invalid_argument(
+          "STRING and LIST arrays can only be inputs of Julia tasks");
+    }
+    functor.record(array.domain());
+    views.push_back(var_size_view(array));
+    return &views.back();
+  }
+  if (is_fixed_compound(code)) {
+    // Julia reinterprets the elements, so an untyped pointer suffices
+    functor.record(array.domain());
+    return array.data().get_inline_allocation().ptr;
+  }
+  std::uintptr_t p;
+  legate::double_dispatch(array.dim(), code, functor, mode, p, array);
+  assert(p != 0);
+  return reinterpret_cast<void*>(p);
+}
+
+// Element strides of an argument padded to three dimensions. Views made by
+// store transforms (transpose, project, broadcast) are mapped onto their
+// source's instance, so Julia cannot assume a dense layout. -1 marks
+// arguments wrapped without strides: var-size, unbound or empty ones.
+inline void append_strides(const legate::PhysicalArray& array,
+                           std::vector<int64_t>& strides) {
+  std::array<int64_t, 3> s{-1, -1, -1};
+  if (!is_var_size(array.type().code()) && !array.data().is_unbound_store() &&
+      !array.domain().empty()) {
+    auto store = array.data();
+    auto alloc = store.get_inline_allocation();
+    const auto size = static_cast<int64_t>(store.type().size());
+    for (int32_t d = 0; d < std::min(array.dim(), 3); ++d) {
+      s[d] = static_cast<int64_t>(alloc.strides[d]) / size;
+    }
+  }
+  strides.insert(strides.end(), s.begin(), s.end());
+}
+
+// Folds a Julia task's return value into the launch's reduction store.
+// Complex and bool returns are rejected as Legion has no matching redops
+// registered for every kind.
+template <typename T>
+void reduce_return(legate::ReductionOpKind kind,
+                   const legate::PhysicalStore& store, const T& value) {
+  auto shp = store.shape<1>();
+  switch (kind) {
+    case legate::ReductionOpKind::ADD:
+      store.reduce_accessor<legate::SumReduction<T>, false, 1>().reduce(
+          shp.lo, value);
+      return;
+    case legate::ReductionOpKind::MUL:
+      store.reduce_accessor<legate::ProdReduction<T>, false, 1>().reduce(
+          shp.lo, value);
+      return;
+    case legate::ReductionOpKind::MAX:
+      store.reduce_accessor<legate::MaxReduction<T>, false, 1>().reduce(
+          shp.lo, value);
+      return;
+    case legate::ReductionOpKind::MIN:
+      store.reduce_accessor<legate::MinReduction<T>, false, 1>().reduce(
+          shp.lo, value);
+      return;
+    default:
+      break;
+  }
+  if constexpr (std::is_integral_v<T>) {
+    switch (kind) {
+      case legate::ReductionOpKind::OR:
+        store.reduce_accessor<legate::OrReduction<T>, false, 1>().reduce(
+            shp.lo, value);
+        return;
+      case legate::ReductionOpKind::AND:
+        store.reduce_accessor<legate::AndReduction<T>, false, 1>().reduce(
+            shp.lo, value);
+        return;
+      case legate::ReductionOpKind::XOR:
+        store.reduce_accessor<legate::XORReduction<T>, false, 1>().reduce(
+            shp.lo, value);
+        return;
+      default:
+        break;
+    }
+  }
+  throw std::invalid_argument("Unsupported reduction for Julia task return.");
+}
+
+struct ReduceReturnFunctor {
+  template <legate::Type::Code CODE>
+  void operator()(legate::ReductionOpKind kind,
+                  const legate::PhysicalStore& store, const void* value) {
+    using CppT = typename legate_util::code_to_cxx<CODE>::type;
+    if constexpr (std::is_arithmetic_v<CppT> && !std::is_same_v<CppT, bool>) {
+      ufi::reduce_return<CppT>(kind, store, *static_cast<const CppT*>(value));
+    } else {
+      throw std::invalid_argument(
+          "Julia task return values must be integer or floating point.");
+    }
+  }
+};
+
+// Pointer to the first element of a nullable array's null mask (true = valid)
+struct NullMaskFunctor {
+  template <int DIM>
+  void* operator()(ufi::AccessMode mode, const legate::PhysicalStore& mask) {
+    auto lo = Realm::Point<DIM>(mask.shape<DIM>().lo);
+    if (mode == ufi::AccessMode::READ) {
+      return const_cast<bool*>(mask.read_accessor<bool, DIM>().ptr(lo));
+    }
+    return mask.write_accessor<bool, DIM>().ptr(lo);
+  }
+};
+
+inline void* null_mask_ptr(ufi::AccessMode mode,
+                           const legate::PhysicalArray& array) {
+  if (!array.nullable()) return nullptr;
+  auto mask = array.null_mask();
+  return legate::dim_dispatch(mask.dim(), NullMaskFunctor{}, mode, mask);
+}
+
+// Allocates (and binds) the buffer backing an unbound 1-D output store.
+struct OutputBufferFunctor {
+  template <legate::Type::Code CODE>
+  void* operator()(legate::PhysicalStore& store, int64_t size) {
+    using CppT = typename legate_util::code_to_cxx<CODE>::type;
+    auto buf = store.create_output_buffer<CppT, 1>(legate::Point<1>(size),
+                                                   true /*bind_buffer*/);
+    if (size == 0) return nullptr;
+    return static_cast<void*>(buf.ptr(legate::Point<1>(0)));
+  }
+};
+
 inline legate::Library create_library(legate::Runtime* rt,
                                       std::string library_name) {
   // leverage default resource config and default mapper
@@ -97,6 +330,43 @@ struct TaskRequestData {
   size_t num_scalars;
   int ndim;
   int64_t dims[3];  // Up to 3 dimensions
+  void* return_ptr;  // nullptr unless the launch reduces a return value
+  int return_type;
+  int* outputs_unbound;  // 1 if output i is unbound (size chosen by the task),
+                         // 2 if it is also nullable
+  void** inputs_null_mask;   // nullptr entries for non-nullable arguments
+  void** outputs_null_mask;
+  int num_threads;  // cores owned by the point task (>1 for OpenMP variants)
+  int comm_rank;  // rank in the launch's CPU communicator
+  int comm_size;  // 0 when the launch has no CPU communicator
+  int numa_node;  // NUMA node of the calling processor, -1 if unknown
+  ArgTypeInfo* inputs_type_info;
+  ArgTypeInfo* outputs_type_info;
+  ArgTypeInfo* scalar_type_info;
+  int64_t* inputs_strides;  // 3 element strides per argument, -1 if packed
+  int64_t* outputs_strides;
+};
+
+// Calls the Julia worker makes back into the running task while it executes,
+// e.g. to allocate an unbound output. Legion only accepts these from the
+// thread running the task, so the worker posts them here and
+// JuliaTaskInterface services them while it waits for completion.
+enum class ServiceKind : int {
+  OUTPUT_BUFFER = 0,
+  SCRATCH_BUFFER = 1,
+  ALLGATHER = 2,
+};
+
+struct ServiceRequest {
+  ServiceKind kind;
+  std::size_t index;  // output index, or byte alignment of a scratch buffer
+  int64_t size;  // elements of an output buffer, bytes of a scratch buffer or
+                 // of each rank's allgather contribution
+  void* result;
+  void* mask_result;  // null mask buffer of a nullable output
+  bool failed;
+  const void* send_buffer;  // allgather only
+  void* recv_buffer;
 };
 
 // Global state
@@ -106,6 +376,11 @@ static std::mutex g_completion_mutex;  // Protects completion CV
 static std::condition_variable g_completion_cv;
 static std::atomic<bool> g_task_done{false};
 static std::atomic<bool> g_work_available{false};  // For polling
+// Request being serviced, owned by the posting thread; null when the slot is
+// free. Guarded by g_completion_mutex, like g_task_active.
+static ServiceRequest* g_service = nullptr;
+static std::condition_variable g_service_cv;
+static bool g_task_active = false;  // a Julia task is running on the worker
 
 extern "C" int legate_poll_work() { return g_work_available.load() ? 1 : 0; }
 
@@ -116,13 +391,234 @@ extern "C" void completion_callback_from_julia() {
   g_completion_cv.notify_one();
 }
 
+extern "C" int legate_task_active() {
+  std::lock_guard<std::mutex> lock(g_completion_mutex);
+  return g_task_active ? 1 : 0;
+}
+
+// Posts a request to the task thread and blocks the caller (a Julia thread
+// of the running task) until it has been serviced. Several threads of one
+// task (e.g. parallel_chunks) may post at once, so each waits for the slot to
+// be free first. Returns false if servicing failed or no task is running.
+static bool post_service_request(ServiceRequest& req) {
+  std::unique_lock<std::mutex> lock(g_completion_mutex);
+  g_service_cv.wait(lock,
+                    [] { return g_service == nullptr || !g_task_active; });
+  if (!g_task_active) {
+    ERROR_PRINT("Julia task service request made outside a running task\n");
+    return false;
+  }
+  g_service = &req;
+  g_completion_cv.notify_one();
+  g_service_cv.wait(lock, [&req] { return g_service != &req; });
+  return !req.failed;
+}
+
+extern "C" int legate_create_output_buffer(std::size_t index, int64_t size,
+                                           void** out, void** mask_out) {
+  ServiceRequest req{ServiceKind::OUTPUT_BUFFER, index, size, nullptr, nullptr,
+                     false};
+  if (!post_service_request(req)) return 0;
+  *out = req.result;
+  *mask_out = req.mask_result;
+  return 1;
+}
+
+extern "C" int legate_create_scratch_buffer(int64_t bytes,
+                                            std::size_t alignment, void** out) {
+  ServiceRequest req{ServiceKind::SCRATCH_BUFFER, alignment, bytes, nullptr,
+                     nullptr, false};
+  if (!post_service_request(req)) return 0;
+  *out = req.result;
+  return 1;
+}
+
+// Gathers `bytes` bytes from every rank of the launch's CPU communicator into
+// `recv`, ordered by rank.
+extern "C" int legate_allgather(const void* send, void* recv, int64_t bytes) {
+  ServiceRequest req{ServiceKind::ALLGATHER, 0,    bytes, nullptr, nullptr,
+                     false,                  send, recv};
+  return post_service_request(req) ? 1 : 0;
+}
+
+// Runs on the task thread with g_completion_mutex held.
+static void service_request(legate::TaskContext& context,
+                            std::vector<bool>& bound, ServiceRequest& req) {
+  try {
+    switch (req.kind) {
+      case ServiceKind::OUTPUT_BUFFER: {
+        if (req.index >= bound.size() || bound[req.index]) {
+          throw std::invalid_argument(
+              "output is not unbound or already has a buffer");
+        }
+        auto array = context.output(req.index);
+        auto store = array.data();
+        if (store.dim() != 1) {
+          throw std::invalid_argument("unbound outputs must be 1-D");
+        }
+        req.result = legate::type_dispatch(store.type().code(),
+                                           OutputBufferFunctor{}, store,
+                                           req.size);
+        if (array.nullable()) {
+          auto mask = array.null_mask();
+          auto buf = mask.create_output_buffer<bool, 1>(
+              legate::Point<1>(req.size), true /*bind_buffer*/);
+          req.mask_result =
+              req.size > 0 ? buf.ptr(legate::Point<1>(0)) : nullptr;
+        }
+        bound[req.index] = true;
+        break;
+      }
+      case ServiceKind::SCRATCH_BUFFER: {
+        // Task-local deferred buffer in the memory closest to the processor;
+        // Legion reclaims it when the point task returns
+        auto buf = legate::create_buffer<std::int8_t>(
+            static_cast<std::size_t>(req.size),
+            legate::Memory::Kind::NO_MEMKIND,
+            std::max<std::size_t>(req.index, 16));
+        req.result = buf.ptr(legate::Point<1>(0));
+        break;
+      }
+      case ServiceKind::ALLGATHER: {
+        if (context.communicators().empty()) {
+          throw std::invalid_argument("the launch has no CPU communicator");
+        }
+        auto comm = context.communicators().front()
+                        .get<legate::comm::coll::CollComm>();
+        // The Julia worker runs one point task at a time, so ranks sharing
+        // this process would never reach the collective together
+        if (comm->nb_threads > 1) {
+          throw std::invalid_argument(
+              "collectives need at most one point task per process");
+        }
+        legate::comm::coll::collAllgather(
+            req.send_buffer, req.recv_buffer, static_cast<int>(req.size),
+            legate::comm::coll::CollDataType::CollUint8, comm);
+        break;
+      }
+    }
+  } catch (const std::exception& e) {
+    ERROR_PRINT("Julia task service request failed: %s\n", e.what());
+    req.failed = true;
+  }
+}
+
 // Initialize async infrastructure - called from Julia
 void initialize_async_system(void* request_ptr) {
   g_request_ptr = static_cast<TaskRequestData*>(request_ptr);
   DEBUG_PRINT("Async system initialized: request=%p\n", g_request_ptr);
 }
 
-inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu) {
+#if defined(__linux__)
+// CPUs of each NUMA node and node of each CPU, read once from sysfs. Empty on
+// machines that expose a single node, where binding would gain nothing.
+struct NumaTopology {
+  std::vector<int> node_of_cpu;
+  std::vector<cpu_set_t> cpus_of_node;
+};
+
+// Parses a sysfs cpulist such as "0-15,32-47".
+static void parse_cpulist(const std::string& list, cpu_set_t& set) {
+  std::size_t pos = 0;
+  while (pos < list.size()) {
+    std::size_t end = list.find(',', pos);
+    if (end == std::string::npos) end = list.size();
+    const std::string range = list.substr(pos, end - pos);
+    const std::size_t dash = range.find('-');
+    if (!range.empty()) {
+      const int lo = std::stoi(range.substr(0, dash));
+      const int hi =
+          dash == std::string::npos ? lo : std::stoi(range.substr(dash + 1));
+      for (int cpu = lo; cpu <= hi && cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &set);
+      }
+    }
+    pos = end + 1;
+  }
+}
+
+static const NumaTopology& numa_topology() {
+  static const NumaTopology topology = [] {
+    NumaTopology t;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(
+             "/sys/devices/system/node", ec)) {
+      const std::string name = entry.path().filename().string();
+      if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+          name.find_first_not_of("0123456789", 4) != std::string::npos) {
+        continue;
+      }
+      const auto node = static_cast<std::size_t>(std::stoi(name.substr(4)));
+      std::ifstream file(entry.path() / "cpulist");
+      std::string list;
+      if (!std::getline(file, list)) continue;
+      if (t.cpus_of_node.size() <= node) {
+        cpu_set_t empty;
+        CPU_ZERO(&empty);
+        t.cpus_of_node.resize(node + 1, empty);
+      }
+      parse_cpulist(list, t.cpus_of_node[node]);
+    }
+    if (t.cpus_of_node.size() < 2) return NumaTopology{};
+    t.node_of_cpu.assign(CPU_SETSIZE, -1);
+    for (std::size_t node = 0; node < t.cpus_of_node.size(); ++node) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &t.cpus_of_node[node])) {
+          t.node_of_cpu[cpu] = static_cast<int>(node);
+        }
+      }
+    }
+    return t;
+  }();
+  return topology;
+}
+
+static int current_numa_node() {
+  const auto& topology = numa_topology();
+  const int cpu = sched_getcpu();
+  if (cpu < 0 || static_cast<std::size_t>(cpu) >= topology.node_of_cpu.size()) {
+    return -1;
+  }
+  return topology.node_of_cpu[cpu];
+}
+#else
+static int current_numa_node() { return -1; }
+#endif
+
+// Restricts the calling thread to the CPUs of NUMA node `node`, or restores
+// the affinity it had before its first binding when `node` is negative. Julia
+// calls this from the thread about to run a task body, so the pages that body
+// touches stay on the socket of the Legate processor. Returns 1 when the
+// thread ends up bound to `node`.
+extern "C" int legate_bind_numa_node(int node) {
+#if defined(__linux__)
+  thread_local int bound = -1;
+  thread_local cpu_set_t original;
+  const auto& topology = numa_topology();
+  if (node < 0) {
+    if (bound >= 0) sched_setaffinity(0, sizeof(cpu_set_t), &original);
+    bound = -1;
+    return 0;
+  }
+  if (node == bound) return 1;
+  if (static_cast<std::size_t>(node) >= topology.cpus_of_node.size()) return 0;
+  if (bound < 0 && sched_getaffinity(0, sizeof(cpu_set_t), &original) != 0) {
+    return 0;
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set_t), &topology.cpus_of_node[node]) !=
+      0) {
+    return 0;
+  }
+  bound = node;
+  return 1;
+#else
+  (void)node;
+  return 0;
+#endif
+}
+
+inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu,
+                               int num_threads = 1) {
   std::int32_t task_id = context.scalar(0).value<std::int32_t>();
 
   const std::size_t num_inputs = context.num_inputs();
@@ -134,13 +630,49 @@ inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu) {
   std::vector<int> inputs_types;
   std::vector<int> outputs_types;
 
-  // Scalar 0 is reserved for task ID. User scalars start at 1.
+  std::vector<void*> inputs_null_mask;
+  std::vector<void*> outputs_null_mask;
+
+  std::vector<ArgTypeInfo> inputs_type_info;
+  std::vector<ArgTypeInfo> outputs_type_info;
+
+  std::vector<int64_t> inputs_strides;
+  std::vector<int64_t> outputs_strides;
+
+  // One per STRING/LIST input at most, so pointers into it stay valid
+  std::vector<VarSizeView> var_size_views;
+  var_size_views.reserve(num_inputs);
+
+  // Scalar 0 is reserved for task ID and scalar 1 for the ReductionOpKind of
+  // the launch's return value, -1 (NO_RETURN in ufi.jl) if it reduces none.
+  // The return slot is then reduction 0. User scalars start after those.
+  constexpr std::size_t reserved_scalars = 2;
+  const bool has_return = context.scalar(1).value<std::int32_t>() >= 0;
   const std::size_t total_scalars = context.num_scalars();
-  const std::size_t num_scalars = (total_scalars > 1) ? total_scalars - 1 : 0;
+  const std::size_t num_scalars = (total_scalars > reserved_scalars)
+                                      ? total_scalars - reserved_scalars
+                                      : 0;
+
+  std::vector<char> return_value;
+  if (has_return) {
+    return_value.resize(context.reduction(0).type().size(), 0);
+  }
 
   std::vector<void*> scalar_values;
   std::vector<int> scalar_types;
 
+  int comm_rank = 0;
+  int comm_size = 0;
+  if (!is_gpu && !context.communicators().empty()) {
+    auto comm =
+        context.communicators().front().get<legate::comm::coll::CollComm>();
+    comm_rank = comm->global_rank;
+    comm_size = comm->global_comm_size;
+  }
+
+  // Read on the processor's own thread, before handing over to Julia
+  const int numa_node = is_gpu ? -1 : current_numa_node();
+
   int ndim = 0;
   int64_t dims[3] = {1, 1, 1};
   ufiFunctor functor{&ndim, dims};
@@ -148,42 +680,62 @@ inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu) {
   for (std::size_t i = 0; i < num_inputs; ++i) {
     auto ps = context.input(i);
     auto code = ps.type().code();
-    auto dim = ps.dim();
-    std::uintptr_t p;
-    legate::double_dispatch(dim, code, functor, ufi::AccessMode::READ, p, ps);
-    assert(p != 0);
-    inputs.push_back(reinterpret_cast<void*>(p));
+    inputs.push_back(
+        argument_ptr(ufi::AccessMode::READ, ps, functor, var_size_views));
     inputs_types.push_back((int)code);
+    inputs_type_info.push_back(type_info(ps.type()));
+    inputs_null_mask.push_back(null_mask_ptr(ufi::AccessMode::READ, ps));
+    append_strides(ps, inputs_strides);
   }
 
+  // Unbound outputs have no buffer until Julia asks for one
+  std::vector<int> outputs_unbound(num_outputs, 0);
+  std::vector<bool> outputs_bound(num_outputs, true);
+
   for (std::size_t i = 0; i < num_outputs; ++i) {
     auto ps = context.output(i);
     auto code = ps.type().code();
-    auto dim = ps.dim();
-    std::uintptr_t p;
-    legate::double_dispatch(dim, code, functor, ufi::AccessMode::WRITE, p, ps);
-    assert(p != 0);
-    outputs.push_back(reinterpret_cast<void*>(p));
     outputs_types.push_back((int)code);
+    outputs_type_info.push_back(type_info(ps.type()));
+    append_strides(ps, outputs_strides);
+    if (!is_var_size(code) && ps.data().is_unbound_store()) {
+      outputs.push_back(nullptr);
+      outputs_null_mask.push_back(nullptr);
+      outputs_unbound[i] = ps.nullable() ? 2 : 1;
+      outputs_bound[i] = false;
+      continue;
+    }
+    outputs.push_back(
+        argument_ptr(ufi::AccessMode::WRITE, ps, functor, var_size_views));
+    outputs_null_mask.push_back(null_mask_ptr(ufi::AccessMode::WRITE, ps));
   }
 
-  // Process User Scalars
+  // Process User Scalars. Their values are copied into one arena, aligned
+  // for any type so Julia can load struct scalars in place.
+  std::vector<std::size_t> scalar_offsets;
+  std::vector<ArgTypeInfo> scalar_type_info;
+  std::size_t arena_bytes = 0;
+  for (std::size_t i = 0; i < num_scalars; ++i) {
+    // Offset past the reserved task_id (and return redop) scalars
+    auto scal = context.scalar(i + reserved_scalars);
+    scalar_offsets.push_back(arena_bytes);
+    scalar_types.push_back((int)scal.type().code());
+    scalar_type_info.push_back(type_info(scal.type()));
+    constexpr std::size_t align = alignof(std::max_align_t);
+    arena_bytes += (scal.size() + align - 1) / align * align;
+  }
+  std::vector<std::max_align_t> scalar_arena(
+      (arena_bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+  auto* arena = reinterpret_cast<char*>(scalar_arena.data());
   for (std::size_t i = 0; i < num_scalars; ++i) {
-    // Offset by 1 because scalar 0 is reserved for task_id
-    auto scal = context.scalar(i + 1);
-    auto code = scal.type().code();
-    auto size = scal.size();
-    const void* p = scal.ptr();
-
-    auto* val_ptr = new char[size];
-    if (p != nullptr) {
-      std::memcpy(val_ptr, p, size);
+    auto scal = context.scalar(i + reserved_scalars);
+    char* val_ptr = arena + scalar_offsets[i];
+    if (scal.ptr() != nullptr) {
+      std::memcpy(val_ptr, scal.ptr(), scal.size());
     } else {
-      std::memset(val_ptr, 0, size);
+      std::memset(val_ptr, 0, scal.size());
     }
-
     scalar_values.push_back(val_ptr);
-    scalar_types.push_back((int)code);
   }
 
   // Instead of calling Julia directly, we:
@@ -220,23 +772,62 @@ inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu) {
     g_request_ptr->num_scalars = num_scalars;
     g_request_ptr->ndim = ndim;
     for (int i = 0; i < 3; ++i) g_request_ptr->dims[i] = dims[i];
+    g_request_ptr->return_ptr = has_return ? return_value.data() : nullptr;
+    g_request_ptr->return_type =
+        has_return ? (int)context.reduction(0).type().code() : 0;
+    g_request_ptr->outputs_unbound = outputs_unbound.data();
+    g_request_ptr->inputs_null_mask = inputs_null_mask.data();
+    g_request_ptr->outputs_null_mask = outputs_null_mask.data();
+    g_request_ptr->num_threads = num_threads;
+    g_request_ptr->comm_rank = comm_rank;
+    g_request_ptr->comm_size = comm_size;
+    g_request_ptr->numa_node = numa_node;
+    g_request_ptr->inputs_type_info = inputs_type_info.data();
+    g_request_ptr->outputs_type_info = outputs_type_info.data();
+    g_request_ptr->scalar_type_info = scalar_type_info.data();
+    g_request_ptr->inputs_strides = inputs_strides.data();
+    g_request_ptr->outputs_strides = outputs_strides.data();
 
     // Reset completion flag
     g_task_done.store(false);
+    g_task_active = true;
     g_work_available.store(true);  // Signal Julia to wake up
 
     DEBUG_PRINT("Signaling Julia for task %d...\n", task_id);
     DEBUG_PRINT("Waiting for Julia to complete task %d...\n", task_id);
 
-    // Wait for Julia to signal completion
-    g_completion_cv.wait(lock, [] { return g_task_done.load(); });
+    // Wait for Julia to signal completion, servicing its requests meanwhile
+    while (true) {
+      g_completion_cv.wait(lock, [] {
+        return g_task_done.load() || g_service != nullptr;
+      });
+      if (g_service == nullptr) break;
+      service_request(context, outputs_bound, *g_service);
+      g_service = nullptr;
+      g_service_cv.notify_all();
+    }
+    // Fails requests still waiting for the slot instead of leaving them for
+    // the next task
+    g_task_active = false;
+    g_service_cv.notify_all();
   }
 
   DEBUG_PRINT("Julia task %d completed!\n", task_id);
 
-  // Free the memory we allocated for the scalar values
-  for (void* ptr : scalar_values) {
-    delete[] static_cast<char*>(ptr);
+  // Unbound outputs the task never asked a buffer for contribute no elements
+  for (std::size_t i = 0; i < num_outputs; ++i) {
+    if (outputs_bound[i]) continue;
+    auto array = context.output(i);
+    array.data().bind_empty_data();
+    if (array.nullable()) array.null_mask().bind_empty_data();
+  }
+
+  if (has_return) {
+    auto kind = static_cast<legate::ReductionOpKind>(
+        context.scalar(1).value<std::int32_t>());
+    auto red = context.reduction(0);
+    legate::type_dispatch(red.type().code(), ReduceReturnFunctor{}, kind,
+                          red.data(), return_value.data());
   }
 }
 
@@ -250,6 +841,13 @@ inline void JuliaTaskInterface(legate::TaskContext context, bool is_gpu) {
 /*static*/ void JuliaCustomTask::cpu_variant(legate::TaskContext context) {
   JuliaTaskInterface(context, false);
 }
+#if defined(LEGATE_JL_OPENMP)
+// An OpenMP processor owns a group of cores; Julia is told how many so the task
+// can split its tile across Julia threads.
+/*static*/ void JuliaCustomTask::omp_variant(legate::TaskContext context) {
+  JuliaTaskInterface(context, false, omp_get_max_threads());
+}
+#endif
 #if LEGATE_DEFINED(LEGATE_USE_CUDA)
 /*static*/ void JuliaCustomGPUTask::gpu_variant(legate::TaskContext context) {
   JuliaTaskInterface(context, true);
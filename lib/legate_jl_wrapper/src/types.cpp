@@ -19,6 +19,10 @@
 
 #include "types.h"
 
+#include <cstdint>
+#include <vector>
+
+#include "jlcxx/stl.hpp"
 #include "legate.h"
 #include "legion/api/config.h"
 
@@ -68,6 +72,34 @@ void wrap_type_getters(jlcxx::Module& mod) {
   // mod.method("complex32", &legate::complex32);
   mod.method("complex64", &legate::complex64);
   mod.method("complex128", &legate::complex128);
+  // compound types; see to_legate_type for how Julia types map onto them
+  mod.method("string_type", &legate::string_type);
+  mod.method("binary_type",
+             [](uint32_t size) { return legate::binary_type(size); });
+  mod.method("fixed_array_type",
+             [](const legate::Type& element, uint32_t n) {
+               return legate::fixed_array_type(element, n);
+             });
+  mod.method("struct_type",
+             [](const std::vector<legate::Type>& fields, bool align) {
+               return legate::struct_type(fields, align);
+             });
+  mod.method("uid", [](const legate::Type& ty) { return ty.uid(); });
+  mod.method("type_size", [](const legate::Type& ty) {
+    return static_cast<uint32_t>(ty.size());
+  });
+}
+
+void wrap_reduction_ops(jlcxx::Module& mod) {
+  mod.add_bits<legate::ReductionOpKind>("ReductionOpKind",
+                                        jlcxx::julia_type("CppEnum"));
+  mod.set_const("REDOP_ADD", legate::ReductionOpKind::ADD);
+  mod.set_const("REDOP_MUL", legate::ReductionOpKind::MUL);
+  mod.set_const("REDOP_MAX", legate::ReductionOpKind::MAX);
+  mod.set_const("REDOP_MIN", legate::ReductionOpKind::MIN);
+  mod.set_const("REDOP_OR", legate::ReductionOpKind::OR);
+  mod.set_const("REDOP_AND", legate::ReductionOpKind::AND);
+  mod.set_const("REDOP_XOR", legate::ReductionOpKind::XOR);
 }
 
 void wrap_privilege_modes(jlcxx::Module& mod) {
@@ -0,0 +1,84 @@
+/* Copyright 2026 Northwestern University,
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+ */
+
+#include "window.h"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "legate.h"
+
+namespace native {
+
+namespace {
+
+std::atomic<std::uint64_t> issued{0};
+std::atomic<std::uint64_t> completed{0};
+
+void complete(legate::TaskContext context) {
+  const auto seq = context.scalar(0).value<std::uint64_t>();
+  // markers may run out of order when fences overlap; keep the maximum
+  auto current = completed.load(std::memory_order_relaxed);
+  while (current < seq &&
+         !completed.compare_exchange_weak(current, seq,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+/*static*/ void MarkerTask::cpu_variant(legate::TaskContext context) {
+  complete(context);
+}
+
+#if defined(LEGATE_JL_OPENMP)
+/*static*/ void MarkerTask::omp_variant(legate::TaskContext context) {
+  complete(context);
+}
+#endif
+
+#if LEGATE_DEFINED(LEGATE_USE_CUDA)
+/*static*/ void MarkerTask::gpu_variant(legate::TaskContext context) {
+  complete(context);
+}
+#endif
+
+void register_window_tasks(legate::Library& library) {
+  MarkerTask::register_variants(library);
+}
+
+std::uint64_t issue_marker() {
+  auto* runtime = legate::Runtime::get_runtime();
+  const auto seq = issued.fetch_add(1) + 1;
+  runtime->issue_execution_fence(false /*block*/);
+  // A single point could run on another rank, whose counter this one never
+  // sees
+  auto task = create_on_every_cpu(legate::LocalTaskID{MARKER_TASK});
+  task.add_scalar_arg(legate::Scalar{seq});
+  runtime->submit(std::move(task));
+  return seq;
+}
+
+std::uint64_t completed_marker() {
+  return completed.load(std::memory_order_acquire);
+}
+
+}  // namespace native
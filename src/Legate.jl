@@ -100,14 +100,24 @@ end
 @wrapmodule(() -> WRAPPER_LIB_PATH)
 
 include("utilities/type_map.jl")
-#include("ufi.jl")
+include("utilities/masked.jl")
 
 # api functions and documentation
 include("api/types.jl")
 include("api/runtime.jl")
 include("api/data.jl")
 include("api/tasks.jl")
+include("api/reductions.jl")
+include("api/elementwise.jl")
+include("api/generators.jl")
+include("api/sorting.jl")
+include("api/sparse.jl")
+include("api/pool.jl")
+include("api/outofcore.jl")
+include("api/arrow.jl")
 include("utilities/attach.jl")
+# after the api files: ufi.jl uses the array types and the task API
+include("ufi.jl")
 
 ### These functions guard against a user trying
 ### to start multiple runtimes and also to allow
@@ -126,24 +136,29 @@ function _finish_runtime()
     _shutdown_done[] && return nothing
     _shutdown_done[] = true
 
-    #if !Legate.UFI_SHUTDOWN_DONE[]
-    #Legate.wait_ufi() # make sure UFI is done
-    #Legate.shutdown_ufi() # shutdown UFI
-    #end
+    finished = Legate.has_finished()
+    if !Legate.UFI_SHUTDOWN_DONE[]
+        # the worker must stay up until every Julia task submitted so far has run
+        finished || Legate.issue_execution_fence(true)
+        Legate.shutdown_ufi() # shutdown UFI
+    end
 
-    Legate.has_finished() && return nothing
+    finished && return nothing
 
     # finish legate runtime
     return Legate.legate_finish()
 end
 
 function _start_runtime()
-    Libdl.dlopen(LEGATE_LIB_PATH, Libdl.RTLD_GLOBAL | Libdl.RTLD_NOW)
-    Libdl.dlopen(WRAPPER_LIB_PATH, Libdl.RTLD_GLOBAL | Libdl.RTLD_NOW)
+    STARTUP_T0[] = time_ns()
+    _timed_phase(:dlopen) do
+        Libdl.dlopen(LEGATE_LIB_PATH, Libdl.RTLD_GLOBAL | Libdl.RTLD_NOW)
+        Libdl.dlopen(WRAPPER_LIB_PATH, Libdl.RTLD_GLOBAL | Libdl.RTLD_NOW)
+    end
 
-    Legate.start_legate()
+    _timed_phase(Legate.start_legate, :start_legate)
     LegatePreferences.maybe_warn_prerelease()
-    #Legate.init_ufi()
+    Legate.init_ufi()
 
     Base.atexit(Legate._finish_runtime)
     return RUNTIME_ACTIVE
@@ -0,0 +1,107 @@
+"""
+    ArrowSchema
+
+Julia layout of the Arrow C data interface `struct ArrowSchema`. Allocate one with
+`Ref(ArrowSchema())` to receive an export, or pass a pointer to one a producer filled in.
+"""
+struct ArrowSchema
+    format::Ptr{Cchar}
+    name::Ptr{Cchar}
+    metadata::Ptr{Cchar}
+    flags::Int64
+    n_children::Int64
+    children::Ptr{Ptr{Cvoid}}
+    dictionary::Ptr{Cvoid}
+    release::Ptr{Cvoid}
+    private_data::Ptr{Cvoid}
+end
+
+ArrowSchema() = ArrowSchema(C_NULL, C_NULL, C_NULL, 0, 0, C_NULL, C_NULL, C_NULL, C_NULL)
+
+"""
+    ArrowArray
+
+Julia layout of the Arrow C data interface `struct ArrowArray`. Allocate one with
+`Ref(ArrowArray())` to receive an export, or pass a pointer to one a producer filled in.
+"""
+struct ArrowArray
+    length::Int64
+    null_count::Int64
+    offset::Int64
+    n_buffers::Int64
+    n_children::Int64
+    buffers::Ptr{Ptr{Cvoid}}
+    children::Ptr{Ptr{Cvoid}}
+    dictionary::Ptr{Cvoid}
+    release::Ptr{Cvoid}
+    private_data::Ptr{Cvoid}
+end
+
+ArrowArray() = ArrowArray(0, 0, 0, 0, 0, C_NULL, C_NULL, C_NULL, C_NULL, C_NULL)
+
+"""
+    release!(x::Ref{<:Union{ArrowArray,ArrowSchema}})
+
+Call the producer's release callback of `x` unless it was already released or moved.
+"""
+function release!(x::Ref{T}) where {T<:Union{ArrowArray,ArrowSchema}}
+    x[].release == C_NULL && return nothing
+    ccall(x[].release, Cvoid, (Ptr{T},), x)
+    return nothing
+end
+
+"""
+    from_arrow(array::Ptr{ArrowArray}, schema::Ptr{ArrowSchema}) -> LogicalArray{T,1}
+
+Move an Arrow array into a one-dimensional `LogicalArray`; `array` is marked released
+and must not be used afterwards, while `schema` still belongs to the caller.
+
+Fixed-width columns (integers, `Float16/32/64`) and the character/child data of `utf8`,
+`large_utf8`, `list` and `large_list` columns are attached without copying; the
+producer's buffers are released once Legate no longer references them. Validity bitmaps,
+`bool` columns and offsets are converted, since Legate keeps one byte per mask entry and
+inclusive ranges instead of offsets. String columns give `T == String` and list columns
+`T == Vector`.
+"""
+function from_arrow(array::Ptr{ArrowArray}, schema::Ptr{ArrowSchema})
+    array == C_NULL && throw(ArgumentError("null ArrowArray"))
+    len = Int(unsafe_load(array).length)
+    impl = _import_arrow(Ptr{Cvoid}(array), Ptr{Cvoid}(schema)) # cxxwrap call
+    c = Int(code(type(impl)))
+    T = c == Int(LIST) ? Vector : code_type_map[c]
+    return LogicalArray{T,1}(impl, (len,))
+end
+
+function from_arrow(array::Ref{ArrowArray}, schema::Ref{ArrowSchema})
+    GC.@preserve array schema begin
+        return from_arrow(
+            Base.unsafe_convert(Ptr{ArrowArray}, array),
+            Base.unsafe_convert(Ptr{ArrowSchema}, schema),
+        )
+    end
+end
+
+"""
+    to_arrow(x::PhysicalArray) -> (Ref{ArrowArray}, Ref{ArrowSchema})
+    to_arrow(x::LogicalArray) -> (Ref{ArrowArray}, Ref{ArrowSchema})
+
+Export a mapped tile as an Arrow array. Fixed-width and character buffers point into
+the mapped instance, which stays mapped until the consumer calls the release callbacks
+(or `release!`). A multi-dimensional tile must be dense and row-major, and is exported
+flattened. A `LogicalArray` is mapped inline first; export a large array tile by tile by
+passing views of it.
+"""
+function to_arrow(x::PhysicalArray)
+    array = Ref(ArrowArray())
+    schema = Ref(ArrowSchema())
+    GC.@preserve array schema begin
+        _export_arrow( # cxxwrap call
+            x,
+            Ptr{Cvoid}(Base.unsafe_convert(Ptr{ArrowArray}, array)),
+            Ptr{Cvoid}(Base.unsafe_convert(Ptr{ArrowSchema}, schema)),
+        )
+    end
+    return array, schema
+end
+
+to_arrow(x::LogicalArray) = to_arrow(get_physical_array(x))
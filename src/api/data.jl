@@ -23,6 +23,30 @@ Convert a string to a `Scalar`.
 """
 string_to_scalar
 
+"""
+    compound_scalar(x) -> Scalar
+
+A `Scalar` holding the isbits struct or tuple `x` as one value of `compound_type(typeof(x))`.
+A Julia task receives it back as a value of the same type, so a parameter block travels
+as one scalar instead of one per field. Like `compound_type`, it throws for a type whose
+opaque Legate type is already taken by another Julia type.
+"""
+function compound_scalar(x::T) where {T}
+    ty = compound_type(T)
+    ref = Ref(x)
+    GC.@preserve ref begin
+        return _compound_scalar(ty, Base.unsafe_convert(Ptr{Cvoid}, ref)) # cxxwrap call
+    end
+end
+
+"""
+    to_scalar(x) -> Scalar
+
+`Scalar(x)` for primitive values and `compound_scalar(x)` for isbits structs and tuples.
+"""
+to_scalar(x::Scalar) = x
+to_scalar(x) = haskey(type_map, typeof(x)) ? Scalar(x) : compound_scalar(x)
+
 """
     create_array(ty::LegateType; dim::Integer=1; 
                  nullable::Bool=false) -> LogicalArray
@@ -34,7 +58,7 @@ Create an unbound array.
 - `dim`: Number of dimensions.
 - `nullable`: Whether the array can contain null values.
 """
-function create_array(ty::Type{T}; dim::Integer=1, nullable::Bool=false) where {T<:SUPPORTED_TYPES}
+function create_array(ty::Type{T}; dim::Integer=1, nullable::Bool=false) where {T}
     impl = create_unbound_array(to_legate_type(ty), dim, nullable) # cxxwrap call
     return LogicalArray{T,dim}(impl, nothing)
 end
@@ -43,19 +67,20 @@ end
     create_array(shape::Vector{B}, ty::Type{T};
                  nullable::Bool=false,
                  optimize_scalar::Bool=false) 
-    where {T<:SUPPORTED_TYPES, B<:Integer} -> LogicalArray
+    where {T, B<:Integer} -> LogicalArray
 
 Create an array with a specified shape.
 
 # Arguments
 - `shape`: Shape of the array.
-- `ty`: Element type.
+- `ty`: Element type: one of `SUPPORTED_TYPES`, or an isbits struct or tuple (see
+  `compound_type`).
 - `nullable`: Whether the array can contain null values.
 - `optimize_scalar`: Whether to optimize scalar storage.
 """
 function create_array(shape::Vector{B}, ty::Type{T};
     nullable::Bool=false,
-    optimize_scalar::Bool=false) where {T<:SUPPORTED_TYPES,B<:Integer}
+    optimize_scalar::Bool=false) where {T,B<:Integer}
     lshape = Legate.Shape(to_cxx_vector(shape)) # convert to CxxWrap type
     impl = create_array(lshape, to_legate_type(ty), nullable, optimize_scalar) # cxxwrap call
     return LogicalArray{T,length(shape)}(impl, Tuple(shape))
@@ -196,6 +221,144 @@ Return a sliced view of the logical store according to the given indices.
 """
 slice
 
+# Views share storage with their source; only the Julia-side shape is rebuilt.
+function _view(x::LogicalStore{T}, impl, dims) where {T}
+    WRITE_TRACKING[] && (VIEW_SOURCES[impl] = x.handle)
+    return LogicalStore{T,length(dims)}(impl, dims)
+end
+
+function _view(x::LogicalArray{T}, impl, dims) where {T}
+    WRITE_TRACKING[] && (VIEW_SOURCES[impl] = x.handle)
+    # the view is in store coordinates, so it keeps the source's buffer layout
+    return LogicalArray{T,length(dims)}(impl, dims, x.order)
+end
+
+function _check_dim(x, dim::Integer)
+    1 <= dim <= ndims(x) || throw(ArgumentError("dimension $dim out of range for $(size(x))"))
+end
+
+# The views below take dimensions and indices of `Array(x)`. A `:col` array's store holds
+# them in reverse, so Julia dimension `dim` is store dimension `N + 1 - dim`.
+_is_col(x) = x isa LogicalArray && x.order === :col
+_store_dim(x, dim::Integer) = _is_col(x) ? ndims(x) + 1 - dim : Int(dim)
+
+"""
+    permutedims(x::LogicalArray, perm) -> LogicalArray
+    permutedims(x::LogicalStore, perm) -> LogicalStore
+
+Return a view of `x` with its dimensions reordered so that dimension `i` of the result is
+dimension `perm[i]` of `x`. No data is copied; `transpose` and `PermutedDimsArray` on
+two-dimensional arrays build the same view.
+"""
+function Base.permutedims(x::Union{LogicalArray,LogicalStore}, perm)
+    N = ndims(x)
+    length(perm) == N && isperm(perm) ||
+        throw(ArgumentError("$perm is not a permutation of $N dimensions"))
+    _is_col(x) && (perm = ntuple(j -> N + 1 - perm[N + 1 - j], N))
+    axes = CxxWrap.StdVector([Int32(p - 1) for p in perm])
+    impl = _transpose(x.handle, axes) # cxxwrap call
+    return _view(x, impl, ntuple(i -> size(x, perm[i]), N))
+end
+
+Base.transpose(x::Union{LogicalArray{T,2},LogicalStore{T,2}}) where {T} = permutedims(x, (2, 1))
+Base.PermutedDimsArray(x::LogicalArray, perm) = permutedims(x, perm)
+
+"""
+    project(x::LogicalArray, dim, index) -> LogicalArray
+    project(x::LogicalStore, dim, index) -> LogicalStore
+
+Return the hyperplane of `x` at `index` along dimension `dim` (both 1-based), a view with
+one dimension fewer.
+"""
+function project(x::Union{LogicalArray,LogicalStore}, dim::Integer, index::Integer)
+    _check_dim(x, dim)
+    d = _store_dim(x, dim)
+    checkbounds(Bool, Base.OneTo(size(x, d)), index) ||
+        throw(BoundsError(size(x), (dim => index,)))
+    return _project(x, d, index)
+end
+
+function _project(x, d::Integer, index::Integer)
+    impl = project(x.handle, Int32(d - 1), Int64(index - 1)) # cxxwrap call
+    dims = size(x)
+    return _view(x, impl, (dims[1:(d - 1)]..., dims[(d + 1):end]...))
+end
+
+"""
+    delinearize(x::LogicalArray, dim, sizes) -> LogicalArray
+    delinearize(x::LogicalStore, dim, sizes) -> LogicalStore
+
+Return a view of `x` where dimension `dim` is split into dimensions of extents `sizes`,
+in the order of the buffer: row-major, or column-major for a `:col` array. `prod(sizes)`
+must equal the extent of dimension `dim`.
+"""
+function delinearize(x::Union{LogicalArray,LogicalStore}, dim::Integer, sizes)
+    _check_dim(x, dim)
+    d = _store_dim(x, dim)
+    prod(sizes; init=1) == size(x, d) ||
+        throw(DimensionMismatch("cannot split extent $(size(x, d)) into $(Tuple(sizes))"))
+    sizes = _is_col(x) ? reverse(Int.(Tuple(sizes))) : Int.(Tuple(sizes))
+    impl = delinearize(x.handle, Int32(d - 1), to_cxx_vector(sizes)) # cxxwrap call
+    dims = size(x)
+    return _view(x, impl, (dims[1:(d - 1)]..., sizes..., dims[(d + 1):end]...))
+end
+
+"""
+    broadcast_view(x::LogicalArray, dim, n) -> LogicalArray
+    broadcast_view(x::LogicalStore, dim, n) -> LogicalStore
+
+Return a view of `x` where dimension `dim`, of extent 1, is repeated `n` times. Every
+element along `dim` aliases the same storage, so the view can only be read. Nullable
+arrays cannot be broadcast.
+"""
+function broadcast_view(x::Union{LogicalArray,LogicalStore}, dim::Integer, n::Integer)
+    _check_dim(x, dim)
+    d = _store_dim(x, dim)
+    size(x, d) == 1 ||
+        throw(DimensionMismatch("only extent-1 dimensions can be broadcast, got $(size(x))"))
+    impl = _broadcast(x.handle, Int32(d - 1), UInt64(n)) # cxxwrap call
+    return _view(x, impl, Base.setindex(size(x), Int(n), d))
+end
+
+const ViewIndex = Union{Integer,AbstractUnitRange,Colon}
+
+"""
+    view(x::LogicalArray, I...) -> LogicalArray
+
+Return a view of `x` selected by one index per dimension: an integer drops the dimension
+(`project`), a unit range keeps it (`slice`) and `:` keeps all of it. No data is copied;
+pass the view to tasks or convert it with `Array`. `I` indexes `Array(x)`, so for a `:col`
+array it runs over the store's dimensions in reverse and `Array(x[I...]) == Array(x)[I...]`.
+"""
+function Base.view(x::LogicalArray{T,N}, I::Vararg{ViewIndex,N}) where {T,N}
+    _is_col(x) && (I = reverse(I))
+    checkbounds(Bool, CartesianIndices(size(x)), I...) || throw(BoundsError(size(x), I))
+    v = x
+    # store dimensions last to first, so projecting does not shift the ones still to visit
+    for d in N:-1:1
+        i = I[d]
+        if i isa Integer
+            v = _project(v, d, i)
+        elseif i isa AbstractUnitRange && i != Base.OneTo(size(v, d))
+            bounds = Slice(StdOptional{Int64}(first(i) - 1), StdOptional{Int64}(last(i)))
+            impl = slice(v.handle, Int32(d - 1), bounds) # cxxwrap call
+            v = _view(v, impl, Base.setindex(size(v), length(i), d))
+        end
+    end
+    return v
+end
+
+"""
+    getindex(x::LogicalArray, I...)
+
+With a range or `:` among the indices, the same lazy view as `view(x, I...)`. With only
+integers, the element itself, read through an inline mapping of that one element.
+"""
+function Base.getindex(x::LogicalArray{T,N}, I::Vararg{ViewIndex,N}) where {T,N}
+    all(i -> i isa Integer, I) || return view(x, I...)
+    return only(Array(view(x, (i:i for i in I)...)))
+end
+
 """
     get_physical_store(LogicalStore) -> PhysicalStore
     get_physical_store(LogicalArray) -> PhysicalStore
@@ -231,6 +394,16 @@ Check if the array supports null values.
 """
 nullable(x::LogicalArray) = nullable(x.handle) # cxxwrap call
 
+"""
+    null_mask(LogicalArray) -> LogicalStore{Bool}
+    null_mask(PhysicalArray) -> PhysicalStore
+
+Return the null mask of a nullable array (`true` marks a valid element).
+"""
+function null_mask(x::LogicalArray{T,N}) where {T,N}
+    return LogicalStore{Bool,N}(null_mask(x.handle), x.dims) # cxxwrap call
+end
+
 """
     data(PhysicalArray) -> PhysicalStore
     data(LogicalArray) -> LogicalStore
@@ -285,6 +458,76 @@ function get_ptr(arr::PhysicalStore)
     return _get_ptr(CxxWrap.CxxPtr(arr)) # cxxwrap call
 end
 
+"""
+    element_strides(PhysicalStore) -> Vector{Int}
+
+Return the element (not byte) stride of each dimension of the mapped store. Views from
+`permutedims`, `project` or `broadcast_view` share their source's instance, so these are
+in general not the dense row-major strides of its shape; broadcast dimensions have
+stride 0.
+"""
+function element_strides(arr::PhysicalStore)
+    return collect(Int, _element_strides(CxxWrap.CxxPtr(arr))) # cxxwrap call
+end
+
+function _row_major_strides(dims::Dims{N}) where {N}
+    return ntuple(d -> prod(dims[(d + 1):end]; init=1), Val(N))
+end
+
+# Extent-1 dimensions are never stepped over, so their stride does not matter.
+function _is_row_major(strides, dims)
+    dense = _row_major_strides(dims)
+    return all(d -> dims[d] == 1 || strides[d] == dense[d], eachindex(dims))
+end
+
+const REDUCTION_OPS = Dict{Symbol,ReductionOpKind}(
+    :+ => REDOP_ADD,
+    :* => REDOP_MUL,
+    :max => REDOP_MAX,
+    :min => REDOP_MIN,
+    :| => REDOP_OR,
+    :& => REDOP_AND,
+    :xor => REDOP_XOR,
+)
+
+to_redop(op::Symbol) = get(REDUCTION_OPS, op) do
+    throw(ArgumentError("unsupported reduction :$(op), expected one of $(keys(REDUCTION_OPS))"))
+end
+
+reduction_identity(::Type{T}, op::Symbol) where {T} = reduction_identity(T, Val(op))
+reduction_identity(::Type{T}, ::Val{:+}) where {T} = zero(T)
+reduction_identity(::Type{T}, ::Val{:*}) where {T} = one(T)
+reduction_identity(::Type{T}, ::Val{:max}) where {T} = typemin(T)
+reduction_identity(::Type{T}, ::Val{:min}) where {T} = typemax(T)
+reduction_identity(::Type{T}, ::Val{:|}) where {T<:Integer} = zero(T)
+reduction_identity(::Type{T}, ::Val{:&}) where {T<:Integer} = ~zero(T)
+reduction_identity(::Type{T}, ::Val{:xor}) where {T<:Integer} = zero(T)
+
+"""
+    Future(T::Type, op::Symbol=:+) -> Future{T}
+
+Create a scalar result initialized to the identity of `op` (`:+`, `:*`, `:max`, `:min`,
+and for integers `:|`, `:&`, `:xor`). Pass it as the `result` of `create_julia_task`
+to reduce the per-point return values of a Julia task. `T` is a fixed-width integer,
+`Float32` or `Float64`.
+"""
+function Future(::Type{T}, op::Symbol=:+) where {T<:FutureElement}
+    store = create_store(reduction_identity(T, op))
+    return Future{T}(store, to_redop(op))
+end
+
+"""
+    fetch(f::Future{T}) -> T
+
+Wait for the launches reducing into `f` and return its value. Only the producers of `f`
+are waited on; unrelated work keeps running.
+"""
+function Base.fetch(f::Future{T}) where {T}
+    ref = Ref{T}()
+    GC.@preserve ref _read_scalar_store(f.store.handle, Base.unsafe_convert(Ptr{Cvoid}, ref)) # cxxwrap call
+    return ref[]
+end
+
 """
     h5read(path::String, name::String; layout::Symbol=:row) -> LogicalArray
 
@@ -330,12 +573,130 @@ function h5write(path::String, name::String, array::LogicalArray{T,N}) where {T,
     return _write_h5(array.handle, path, name)
 end
 
+# Element types the checkpoint codec handles (Float16 and compound types are not among them)
+const CheckpointElement = Union{
+    Bool,Int8,Int16,Int32,Int64,UInt8,UInt16,UInt32,UInt64,Float32,Float64,ComplexF32,ComplexF64
+}
+
+"""
+    write_checkpoint(dir::String, array::LogicalArray)
+
+Write `array` to the directory `dir` in Legate.jl's compressed checkpoint format: a
+`manifest` with the element type, shape and blocking, plus one `tile_<i>.lgc` file per
+block of rows. Every block is encoded and written by its own point task: its bytes are
+shuffled into one plane per byte of the element type, and each plane is delta- and
+run-length coded. Floating-point fields that vary smoothly keep nearly constant sign and
+exponent bytes, so those planes shrink to almost nothing.
+
+The write is asynchronous. Later launches (including a `read_checkpoint` of the same
+directory) are ordered after it; call `runtime_sync` before another process reads the files.
+Only bound, non-nullable arrays of `Bool`, integer, `Float32`/`Float64` and complex
+elements are supported. As with `h5write`, a `:col` array must be read back with
+`layout=:col`.
+"""
+function write_checkpoint(dir::String, array::LogicalArray{T,N}) where {T,N}
+    T <: CheckpointElement ||
+        throw(ArgumentError("checkpoints support Bool, integer, Float32/64 and complex \
+            arrays, got $(T)"))
+    if array.order === :col && N > 1
+        @warn "Writing a column-major array; read it back with " *
+            "`Legate.read_checkpoint($(repr(dir)); layout=:col)`."
+    end
+    return _write_checkpoint(array.handle, dir) # cxxwrap call
+end
+
+"""
+    read_checkpoint(dir::String; layout::Symbol=:row) -> LogicalArray
+
+Create an array from the checkpoint in `dir` written by `write_checkpoint`. The manifest
+and the header of every block file are checked up front, so a missing or mismatched block
+throws here; if this process has checkpoint writes in flight, that waits for them. The
+blocks are then decoded in parallel straight into the array's instances, one point task
+per block file. `layout` tags the array's `order`, as in `h5read`.
+"""
+function read_checkpoint(dir::String; layout::Symbol=:row)
+    layout in (:row, :col) ||
+        throw(ArgumentError("layout must be :row or :col, got :$(layout)"))
+    impl = _read_checkpoint(dir) # cxxwrap call
+    shp = Tuple(Int.(shape(impl)))
+    T = code_type_map[Int(code(type(impl)))]
+    return LogicalArray{T,length(shp)}(impl, shp, layout)
+end
+
 function partition_by_tiling(store::LogicalStore{T,N}, tile_shape) where {T,N}
     impl = partition_by_tiling(store.handle, to_cxx_vector(tile_shape)) # cxxwrap call
-    return LogicalStorePartition{T,N}(impl)
+    return LogicalStorePartition{T,N}(impl, store)
 end
 
 function partition_by_tiling(store::LogicalStore{T,N}, tile_shape, color_shape) where {T,N}
     impl = partition_by_tiling(store.handle, to_cxx_vector(tile_shape), to_cxx_vector(color_shape)) # cxxwrap call
-    return LogicalStorePartition{T,N}(impl)
+    return LogicalStorePartition{T,N}(impl, store)
+end
+
+"""
+    offload_to(x::Union{LogicalArray,LogicalStore}, target::StoreTarget)
+
+Move the data of `x` into `target` memory (e.g. `SYSMEM`) and release its instances in
+every other memory. Use it to evict cold arrays from framebuffer or socket memory.
+"""
+function offload_to(x::Union{LogicalArray,LogicalStore}, target::StoreTarget)
+    return offload_to(x.handle, target) # cxxwrap call
+end
+
+"""
+    prefetch(x::Union{LogicalArray,LogicalStore}, target::StoreTarget) -> x
+
+Start copying `x` into `target` memory without blocking, so a later task running on the
+processors that own `target` finds it already resident. Unlike
+`get_physical_array(x, target)`, no inline mapping is made and the caller never waits.
+`target` is `SYSMEM`, `FBMEM`, or `SOCKETMEM` when the wrapper is built with OpenMP;
+GPU tasks read from framebuffer memory, so `ZCMEM` is rejected.
+"""
+function prefetch(x::Union{LogicalArray,LogicalStore}, target::StoreTarget)
+    _prefetch(x.handle, target) # cxxwrap call
+    return x
+end
+
+"""
+    ready_event(x::Union{LogicalArray,LogicalStore}) -> ReadyEvent
+
+Return an event for the producers of `x` submitted so far. A small task that reads `x`
+is launched behind them; the event is ready once it has run. Unlike `runtime_sync`,
+nothing else in the pipeline is waited on.
+"""
+function ready_event(x::Union{LogicalArray,LogicalStore})
+    ev = ReadyEvent(_watch(x.handle), false) # cxxwrap call
+    return finalizer(ev) do e
+        e.done || _forget_ticket(e.ticket) # cxxwrap call
+    end
+end
+
+"""
+    isready(ev::ReadyEvent) -> Bool
+
+Whether the producers `ev` tracks have finished. Never blocks.
+"""
+function Base.isready(ev::ReadyEvent)
+    ev.done && return true
+    if _ticket_ready(ev.ticket) # cxxwrap call
+        _forget_ticket(ev.ticket) # cxxwrap call
+        ev.done = true
+    end
+    return ev.done
+end
+
+"""
+    wait(ev::ReadyEvent)
+    wait(x::Union{LogicalArray,LogicalStore})
+
+Wait until `ev` is ready, or until the producers of `x` submitted so far have finished.
+The calling Julia task yields while waiting, so other tasks keep running meanwhile.
+"""
+function Base.wait(ev::ReadyEvent)
+    spins = 0
+    while !isready(ev)
+        spins = _backoff(spins)
+    end
+    return nothing
 end
+Base.wait(x::Union{LogicalArray,LogicalStore}) = wait(ready_event(x))
@@ -0,0 +1,137 @@
+# Op codes understood by the native elementwise tasks (see UnaryOp, BinaryOp and CompareOp
+# in lib/legate_jl_wrapper/include/elementwise.h)
+const UNARY_CODES = Dict{Symbol,Int32}(
+    :- => 0, :abs => 1, :sqrt => 2, :exp => 3, :log => 4, :sin => 5, :cos => 6, :abs2 => 7
+)
+const BINARY_CODES = Dict{Symbol,Int32}(
+    :+ => 0, :- => 1, :* => 2, :/ => 3, :min => 4, :max => 5, :^ => 6
+)
+const COMPARE_CODES = Dict{Symbol,Int32}(
+    :(==) => 0, :!= => 1, :< => 2, :<= => 3, :> => 4, :>= => 5
+)
+
+function _op_code(table, op::Symbol)
+    return get(table, op) do
+        throw(ArgumentError("unsupported op :$(op), expected one of $(keys(table))"))
+    end
+end
+
+# New bound array with the shape and layout of `a`
+function _similar(a::LogicalArray{T,N}, ::Type{S}=T) where {T,N,S}
+    out = create_array(collect(Int64, size(a)), S)
+    return LogicalArray{S,N}(out.handle, out.dims, a.order)
+end
+
+function _check_same_shape(a::LogicalArray, b::LogicalArray)
+    size(a) == size(b) ||
+        throw(DimensionMismatch("arrays have shapes $(size(a)) and $(size(b))"))
+    a.order === b.order ||
+        throw(ArgumentError("arrays have different layouts (:$(a.order), :$(b.order))"))
+    return nothing
+end
+
+# Launches a native task with every argument aligned to the first input
+function _launch_native(id::LocalTaskID, inputs, outputs, scalars)
+    rt = get_runtime()
+    task = create_task(rt, native_library(), id)
+    in_vars = Vector{Variable}([add_input(task, a) for a in inputs])
+    out_vars = Vector{Variable}([add_output(task, a) for a in outputs])
+    default_alignment(task, in_vars, out_vars)
+    for s in scalars
+        add_scalar(task, Scalar(s))
+    end
+    submit_task(rt, task)
+    return nothing
+end
+
+"""
+    unary_op(op::Symbol, a::LogicalArray) -> LogicalArray
+
+Apply `op` to every element of `a` with a built-in native task. `op` is one of `:-`,
+`:abs`, `:abs2`, or, for floating-point arrays, `:sqrt`, `:exp`, `:log`, `:sin`, `:cos`.
+"""
+function unary_op(op::Symbol, a::LogicalArray{T}) where {T<:NativeNumeric}
+    T <: Integer && op ∉ (:-, :abs, :abs2) &&
+        throw(ArgumentError(":$(op) needs a floating-point array, got $(T)"))
+    out = _similar(a)
+    _launch_native(NATIVE_UNARY_TASK, (a,), (out,), (_op_code(UNARY_CODES, op),))
+    return out
+end
+
+function _check_binary(op::Symbol, ::Type{T}) where {T}
+    # integer :/ would trap (or be undefined) on a zero divisor or typemin(T) / -1
+    T <: Integer && op in (:/, :^) &&
+        throw(ArgumentError(":$(op) needs a floating-point array, got $(T)"))
+    return _op_code(BINARY_CODES, op)
+end
+
+"""
+    binary_op(op::Symbol, a::LogicalArray, b::Union{LogicalArray,Number}) -> LogicalArray
+
+Combine `a` and `b` elementwise with a built-in native task. `op` is one of `:+`, `:-`,
+`:*`, `:min`, `:max`, or, for floating-point arrays, `:/` and `:^`. `b` is either an
+array of the same eltype, shape and layout, or a scalar converted to the eltype of `a`.
+"""
+function binary_op(
+    op::Symbol, a::LogicalArray{T}, b::LogicalArray{T}
+) where {T<:NativeNumeric}
+    _check_same_shape(a, b)
+    code = _check_binary(op, T)
+    out = _similar(a)
+    _launch_native(NATIVE_BINARY_TASK, (a, b), (out,), (code,))
+    return out
+end
+
+function binary_op(op::Symbol, a::LogicalArray{T}, b::Number) where {T<:NativeNumeric}
+    code = _check_binary(op, T)
+    out = _similar(a)
+    _launch_native(NATIVE_BINARY_TASK, (a,), (out,), (code, convert(T, b)))
+    return out
+end
+
+"""
+    compare(op::Symbol, a::LogicalArray, b::LogicalArray) -> LogicalArray{Bool}
+
+Compare `a` and `b` elementwise with a built-in native task. `op` is one of `:(==)`,
+`:!=`, `:<`, `:<=`, `:>`, `:>=`.
+"""
+function compare(
+    op::Symbol, a::LogicalArray{T}, b::LogicalArray{T}
+) where {T<:Union{Bool,NativeNumeric}}
+    _check_same_shape(a, b)
+    out = _similar(a, Bool)
+    _launch_native(NATIVE_COMPARE_TASK, (a, b), (out,), (_op_code(COMPARE_CODES, op),))
+    return out
+end
+
+"""
+    cast(::Type{S}, a::LogicalArray) -> LogicalArray{S}
+
+Convert every element of `a` to `S` with a built-in native task (C++ `static_cast`
+semantics, so float to integer conversions truncate instead of throwing).
+"""
+function cast(
+    ::Type{S}, a::LogicalArray{T}
+) where {S<:Union{Bool,NativeNumeric},T<:Union{Bool,NativeNumeric}}
+    out = _similar(a, S)
+    _launch_native(NATIVE_CAST_TASK, (a,), (out,), ())
+    return out
+end
+
+"""
+    axpy!(alpha::Number, x::LogicalArray, y::LogicalArray) -> y
+
+Compute `y = alpha * x + y` in place with a single fused native task.
+"""
+function axpy!(alpha::Number, x::LogicalArray{T}, y::LogicalArray{T}) where {T<:NativeNumeric}
+    _check_same_shape(x, y)
+    _launch_native(NATIVE_AXPY_TASK, (x, y), (y,), (convert(T, alpha),))
+    return y
+end
+
+Base.:+(a::LogicalArray, b::LogicalArray) = binary_op(:+, a, b)
+Base.:-(a::LogicalArray, b::LogicalArray) = binary_op(:-, a, b)
+Base.:-(a::LogicalArray) = unary_op(:-, a)
+Base.:*(a::LogicalArray, s::Number) = binary_op(:*, a, s)
+Base.:*(s::Number, a::LogicalArray) = binary_op(:*, a, s)
+Base.:/(a::LogicalArray{<:AbstractFloat}, s::Number) = binary_op(:/, a, s)
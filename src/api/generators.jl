@@ -0,0 +1,76 @@
+# Distribution codes understood by the native RandomTask (see Distribution in
+# lib/legate_jl_wrapper/include/generator.h)
+const RANDOM_DISTRIBUTIONS = Dict{Symbol,Int32}(:uniform => 0, :normal => 1)
+
+# Seed handed to the next `random!` call that does not pass one
+const _next_seed = Threads.Atomic{UInt64}(0x5eed)
+
+"""
+    seed!(seed::Integer)
+
+Set the seed used by the next `random`/`random!` call that does not pass `seed`. Each such
+call advances it by one, so a program that seeds once replays the same sequence of arrays.
+"""
+seed!(seed::Integer) = (_next_seed[] = UInt64(seed); nothing)
+
+_take_seed() = Threads.atomic_add!(_next_seed, one(UInt64))
+
+"""
+    fill!(arr::LogicalArray, value) -> arr
+
+Set every element of `arr` to `value` with a Legate fill; no task body runs.
+"""
+function Base.fill!(
+    arr::LogicalArray{T}, value
+) where {T<:Union{Bool,NativeNumeric,ComplexF32,ComplexF64}}
+    _issue_fill(arr.handle, Scalar(convert(T, value))) # cxxwrap call
+    return _written!(arr)
+end
+
+"""
+    full(dims::Dims, value::T) -> LogicalArray{T}
+
+Create an array of shape `dims` with every element set to `value`.
+"""
+function full(dims::Dims, value::T) where {T}
+    return fill!(create_array(collect(Int64, dims), T), value)
+end
+
+"""
+    iota(T::Type, n::Integer; start=zero(T), step=one(T)) -> LogicalArray{T,1}
+
+Create the vector `[start, start + step, ..., start + (n - 1) * step]` with a native task.
+"""
+function iota(::Type{T}, n::Integer; start=zero(T), step=one(T)) where {T<:NativeNumeric}
+    out = create_array([Int64(n)], T)
+    _launch_native(NATIVE_IOTA_TASK, (), (out,), (convert(T, start), convert(T, step), Int64(n)))
+    return out
+end
+
+"""
+    random!(arr::LogicalArray; dist::Symbol=:uniform, seed::Integer) -> arr
+
+Fill a `Float32`/`Float64` array with random numbers from a native task. `dist` is
+`:uniform` (on `[0, 1)`) or `:normal` (standard normal). Every element comes from a
+Philox4x32-10 counter-based generator keyed on `seed` and the element's global index, so
+the result depends only on `seed` and the array shape, never on how the array is
+partitioned or on how many processors run the task. Without `seed`, the value set by
+`seed!` is used and then advanced.
+"""
+function random!(
+    arr::LogicalArray{T}; dist::Symbol=:uniform, seed::Integer=_take_seed()
+) where {T<:Union{Float32,Float64}}
+    code = _op_code(RANDOM_DISTRIBUTIONS, dist)
+    extents = map(Int64, size(arr))
+    _launch_native(NATIVE_RANDOM_TASK, (), (arr,), (code, UInt64(seed), extents...))
+    return arr
+end
+
+"""
+    random(T::Type, dims::Integer...; dist::Symbol=:uniform, seed::Integer) -> LogicalArray{T}
+
+Create an array of shape `dims` filled by [`random!`](@ref).
+"""
+function random(::Type{T}, dims::Integer...; kwargs...) where {T<:Union{Float32,Float64}}
+    return random!(create_array(collect(Int64, dims), T); kwargs...)
+end
@@ -0,0 +1,146 @@
+const TILE_ADVICE = (willneed=Int32(0), evict=Int32(1))
+
+"""
+    FileBackedArray{T,N}
+
+A row-major array whose storage is a memory-mapped file instead of anonymous system
+memory. Create one with `file_array`; pass `fa.array` to tasks like any other
+`LogicalArray`. Pages are read from the file on first touch and the kernel may write
+them back and drop them at any time, so arrays larger than RAM only need their working
+set resident.
+"""
+struct FileBackedArray{T,N}
+    array::LogicalArray{T,N}
+    path::String
+    ptr::Ptr{Cvoid}
+    bytes::Int
+    writable::Bool
+end
+
+Base.size(fa::FileBackedArray) = size(fa.array)
+Base.size(fa::FileBackedArray, i::Integer) = size(fa.array, i)
+Base.eltype(::FileBackedArray{T}) where {T} = T
+
+"""
+    file_array(path, T, dims...; writable::Bool=true) -> FileBackedArray{T}
+
+Map the file at `path` and attach it as a row-major array of `T` with shape `dims`. A
+writable mapping creates the file or grows it to fit; a read-only one requires the file
+to hold at least `prod(dims) * sizeof(T)` bytes. The file stays mapped until Legate
+releases the array.
+"""
+function file_array(
+    path::AbstractString, ::Type{T}, dims::Integer...; writable::Bool=true
+) where {T<:SUPPORTED_TYPES}
+    shape = Int.(dims)
+    bytes = prod(shape; init=1) * sizeof(T)
+    bytes > 0 || throw(ArgumentError("file_array needs a non-empty shape"))
+    ptr = _map_file(String(path), UInt64(bytes), writable) # cxxwrap call
+    lshape = Shape(to_cxx_vector(collect(UInt64, shape)))
+    impl = try
+        _attach_mapped(ptr, UInt64(bytes), lshape, to_legate_type(T), writable) # cxxwrap call
+    catch
+        _unmap_file(ptr, UInt64(bytes)) # cxxwrap call
+        rethrow()
+    end
+    arr = LogicalArray{T,length(shape)}(impl, shape)
+    return FileBackedArray{T,length(shape)}(arr, String(path), ptr, bytes, writable)
+end
+
+"""
+    TileCache(fa::FileBackedArray; tile_rows::Integer, capacity::Integer=2)
+
+Tracks which tiles of `fa` should be resident. A tile is `tile_rows` consecutive rows of
+the leading dimension, i.e. one contiguous byte range of the file and one color of
+`partition_by_tiling` with that tile shape. At most `capacity` tiles are kept resident;
+`require!` on another tile evicts the least recently used one.
+"""
+mutable struct TileCache{T,N}
+    source::FileBackedArray{T,N}
+    tile_rows::Int
+    capacity::Int
+    resident::Vector{Int} # least recently used first
+    evictions::Int
+    lock::ReentrantLock
+end
+
+function TileCache(
+    fa::FileBackedArray{T,N}; tile_rows::Integer, capacity::Integer=2
+) where {T,N}
+    tile_rows > 0 || throw(ArgumentError("tile_rows must be positive"))
+    capacity > 0 || throw(ArgumentError("capacity must be positive"))
+    return TileCache{T,N}(fa, tile_rows, capacity, Int[], 0, ReentrantLock())
+end
+
+ntiles(cache::TileCache) = cld(size(cache.source, 1), cache.tile_rows)
+
+function _tile_rows(cache::TileCache, k::Integer)
+    1 <= k <= ntiles(cache) || throw(BoundsError(cache, k))
+    lo = (k - 1) * cache.tile_rows
+    return lo, min(lo + cache.tile_rows, size(cache.source, 1))
+end
+
+function _tile_bytes(cache::TileCache{T}, k::Integer) where {T}
+    lo, hi = _tile_rows(cache, k)
+    row_bytes = prod(Base.tail(size(cache.source)); init=1) * sizeof(T)
+    return UInt64(lo * row_bytes), UInt64((hi - lo) * row_bytes)
+end
+
+function _advise(cache::TileCache, k::Integer, advice::Int32)
+    offset, len = _tile_bytes(cache, k)
+    _advise_mapped(cache.source.ptr, offset, len, advice) # cxxwrap call
+end
+
+"""
+    require!(cache::TileCache, k::Integer) -> cache
+
+Mark tile `k` as most recently used and start reading it in if it is not resident,
+evicting least recently used tiles beyond `capacity`. Evicted tiles are written back to
+the file first; a task that still reads one just faults its pages in again.
+"""
+function require!(cache::TileCache, k::Integer)
+    lock(cache.lock) do
+        i = findfirst(==(k), cache.resident)
+        if isnothing(i)
+            _advise(cache, k, TILE_ADVICE.willneed)
+            push!(cache.resident, k)
+        else
+            push!(cache.resident, popat!(cache.resident, i))
+        end
+        while length(cache.resident) > cache.capacity
+            _advise(cache, popfirst!(cache.resident), TILE_ADVICE.evict)
+            cache.evictions += 1
+        end
+    end
+    return cache
+end
+
+"""
+    tile(cache::TileCache, k::Integer) -> LogicalArray
+
+A view of tile `k` of the cached array. It aliases the file-backed array, so writes
+through it land in the file.
+"""
+function tile(cache::TileCache{T,N}, k::Integer) where {T,N}
+    lo, hi = _tile_rows(cache, k)
+    impl = _tile_view(cache.source.array.handle, lo, hi) # cxxwrap call
+    return LogicalArray{T,N}(impl, (hi - lo, Base.tail(size(cache.source))...))
+end
+
+"""
+    stream_tiles(f, cache::TileCache) -> Nothing
+
+Call `f(tile(cache, k))` for every tile in order. Before each call the next tile is
+required as well, so its pages are read in while the tasks `f` launches on the current
+one run.
+"""
+function stream_tiles(f, cache::TileCache)
+    n = ntiles(cache)
+    for k in 1:n
+        require!(cache, k)
+        # read ahead only when that cannot evict the tile about to be used
+        k < n && cache.capacity > 1 && require!(cache, k + 1)
+        f(tile(cache, k))
+    end
+    return nothing
+end
@@ -0,0 +1,120 @@
+"""
+    StorePool(; max_per_key::Integer=8)
+
+A cache of temporary arrays keyed by `(shape, element type, nullable)`. Loops that need a
+temporary every iteration can `acquire!` one and `release!` it back, and the next
+`acquire!` with the same key gets the same region and instance back instead of a freshly
+allocated one. At most `max_per_key` released arrays are kept per key; extra ones are
+dropped and freed as usual.
+
+The contents of a recycled array are undefined. Write it as a task output before reading
+it: Legate maps outputs with discard privileges, so stale data is never copied in.
+"""
+mutable struct StorePool
+    free::Dict{Tuple{Tuple,DataType,Bool},Vector{LogicalArray}}
+    max_per_key::Int
+    hits::Int
+    misses::Int
+    lock::ReentrantLock
+end
+
+function StorePool(; max_per_key::Integer=8)
+    return StorePool(
+        Dict{Tuple{Tuple,DataType,Bool},Vector{LogicalArray}}(), max_per_key, 0, 0, ReentrantLock()
+    )
+end
+
+"""
+    DEFAULT_POOL
+
+The `StorePool` used by `acquire!`/`release!`/`with_temporary` when no pool is passed.
+"""
+const DEFAULT_POOL = StorePool()
+
+"""
+    acquire!([pool::StorePool], shape, T::Type; nullable::Bool=false) -> LogicalArray{T}
+
+Return a bound array of `shape` and `T`, taken from `pool` when one was released there
+(a hit) or created with `create_array` otherwise (a miss).
+"""
+function acquire!(
+    pool::StorePool, shape, ::Type{T}; nullable::Bool=false
+) where {T<:SUPPORTED_TYPES}
+    dims = Tuple(Int.(shape))
+    key = (dims, T, nullable)
+    lock(pool.lock) do
+        cached = get(pool.free, key, nothing)
+        if !isnothing(cached) && !isempty(cached)
+            pool.hits += 1
+            arr = pop!(cached)::LogicalArray{T,length(dims)}
+            # the contents are undefined, so the recycled array starts over as `:row`
+            return LogicalArray{T,length(dims)}(arr.handle, arr.dims)
+        end
+        pool.misses += 1
+        return create_array(collect(Int64, dims), T; nullable)
+    end
+end
+acquire!(shape, ::Type{T}; kwargs...) where {T} = acquire!(DEFAULT_POOL, shape, T; kwargs...)
+
+"""
+    release!([pool::StorePool], arr::LogicalArray) -> Nothing
+
+Hand `arr` back to `pool` for reuse. `arr` must not be used afterwards, and releasing it
+twice is an error.
+"""
+function release!(pool::StorePool, arr::LogicalArray{T}) where {T}
+    isnothing(arr.dims) && throw(ArgumentError("unbound arrays cannot be pooled"))
+    key = (arr.dims, T, nullable(arr.handle))
+    lock(pool.lock) do
+        cached = get!(() -> LogicalArray[], pool.free, key)
+        # a second copy would be handed out to two owners at once
+        any(x -> x.handle === arr.handle, cached) &&
+            throw(ArgumentError("array was already released to this pool"))
+        length(cached) < pool.max_per_key && push!(cached, arr)
+    end
+    return nothing
+end
+release!(arr::LogicalArray) = release!(DEFAULT_POOL, arr)
+
+"""
+    with_temporary(f, [pool::StorePool], shape, T::Type; nullable::Bool=false)
+
+Call `f(arr)` with an array from `acquire!` and release it afterwards, even if `f` throws.
+"""
+function with_temporary(f, pool::StorePool, shape, ::Type{T}; nullable::Bool=false) where {T}
+    arr = acquire!(pool, shape, T; nullable)
+    try
+        return f(arr)
+    finally
+        release!(pool, arr)
+    end
+end
+function with_temporary(f, shape, ::Type{T}; kwargs...) where {T}
+    return with_temporary(f, DEFAULT_POOL, shape, T; kwargs...)
+end
+
+"""
+    pool_stats([pool::StorePool]) -> NamedTuple
+
+Hit and miss counts of `pool` and the number of arrays it currently holds.
+"""
+function pool_stats(pool::StorePool=DEFAULT_POOL)
+    lock(pool.lock) do
+        pooled = sum(length, values(pool.free); init=0)
+        return (; hits=pool.hits, misses=pool.misses, pooled)
+    end
+end
+
+"""
+    empty!(pool::StorePool) -> pool
+
+Drop every array held by `pool` and reset its statistics.
+"""
+function Base.empty!(pool::StorePool)
+    lock(pool.lock) do
+        empty!(pool.free)
+        pool.hits = 0
+        pool.misses = 0
+    end
+    return pool
+end
@@ -0,0 +1,91 @@
+# Op codes understood by the native ReduceTask / ArgReduceTask (see ReduceOp in
+# lib/legate_jl_wrapper/include/reduction.h)
+const REDUCE_CODES = Dict{Symbol,Int32}(:+ => 0, :* => 1, :min => 2, :max => 3, :sumsq => 4)
+const ARGMIN_CODE = Int32(5)
+const ARGMAX_CODE = Int32(6)
+
+# Element types the native arithmetic tasks accept (Float16 has no host kernel)
+const NativeNumeric = Union{Int8,Int16,Int32,Int64,UInt8,UInt16,UInt32,UInt64,Float32,Float64}
+
+"""
+    reduce_async(op::Symbol, arr::LogicalArray) -> Future
+
+Reduce every element of `arr` with the built-in native reduction task, without leaving
+Legate. `op` is one of `:+`, `:*`, `:min`, `:max`, or `:sumsq` (sum of squares, accumulated
+in `Float64`). Each point task folds its tile with a vectorized loop (split over OpenMP
+threads when the OpenMP variant runs) and Legate combines the partials into the returned
+`Future`; nothing blocks until it is fetched.
+
+Results are accumulated in the element type, so integer sums can overflow where Julia's
+`sum` would widen.
+"""
+function reduce_async(op::Symbol, arr::LogicalArray{T}) where {T<:NativeNumeric}
+    code = get(REDUCE_CODES, op) do
+        throw(ArgumentError("unsupported reduction :$(op), expected one of $(keys(REDUCE_CODES))"))
+    end
+    result = op === :sumsq ? Future(Float64, :+) : Future(T, op)
+    rt = get_runtime()
+    task = create_task(rt, native_library(), NATIVE_REDUCE_TASK)
+    add_input(task, arr)
+    add_reduction(task, result.store, result.redop)
+    add_scalar(task, Scalar(code))
+    submit_task(rt, task)
+    return result
+end
+
+function _nonempty_reduce(op::Symbol, arr::LogicalArray, name)
+    prod(size(arr)) == 0 && throw(ArgumentError("$(name) over an empty collection is not allowed"))
+    return fetch(reduce_async(op, arr))
+end
+
+Base.sum(arr::LogicalArray{<:NativeNumeric}) = fetch(reduce_async(:+, arr))
+Base.prod(arr::LogicalArray{<:NativeNumeric}) = fetch(reduce_async(:*, arr))
+Base.minimum(arr::LogicalArray{<:NativeNumeric}) = _nonempty_reduce(:min, arr, "minimum")
+Base.maximum(arr::LogicalArray{<:NativeNumeric}) = _nonempty_reduce(:max, arr, "maximum")
+
+"""
+    norm(arr::LogicalArray) -> Float64
+
+Euclidean norm of all elements of `arr`, computed with the native `:sumsq` reduction.
+"""
+norm(arr::LogicalArray{<:NativeNumeric}) = sqrt(fetch(reduce_async(:sumsq, arr)))
+
+# Launches the native ArgReduceTask and picks the best of the per-tile candidates. Each
+# candidate is one value plus its N zero-based store coordinates.
+function _arg_reduce(code::Int32, arr::LogicalArray{T,N}, better) where {T,N}
+    prod(size(arr)) == 0 && throw(ArgumentError("collection must be non-empty"))
+    values = create_array(T)
+    coords = create_array(Int64)
+    rt = get_runtime()
+    task = create_task(rt, native_library(), NATIVE_ARG_REDUCE_TASK)
+    add_input(task, arr)
+    add_output(task, values)
+    add_output(task, coords)
+    add_scalar(task, Scalar(code))
+    submit_task(rt, task)
+
+    vals = Array(values)
+    crds = reshape(Array(coords), N, :)
+    best = 1
+    for i in 2:length(vals)
+        if better(vals[i], vals[best]) ||
+           (vals[i] == vals[best] && Tuple(view(crds, :, i)) < Tuple(view(crds, :, best)))
+            best = i
+        end
+    end
+    # Store coordinates are row-major; `:col` arrays see them in reverse
+    idx = Tuple(view(crds, :, best)) .+ 1
+    idx = arr.order === :col ? reverse(idx) : idx
+    return N == 1 ? Int(idx[1]) : CartesianIndex(idx)
+end
+
+"""
+    argmin(arr::LogicalArray) -> Union{Int,CartesianIndex}
+    argmax(arr::LogicalArray) -> Union{Int,CartesianIndex}
+
+Index of the smallest/largest element of `arr`, found by the native arg-reduction task.
+Ties resolve to the first occurrence in the store's row-major order, which for `:col`
+arrays is Julia's column-major order.
+"""
+Base.argmin(arr::LogicalArray{<:NativeNumeric}) = _arg_reduce(ARGMIN_CODE, arr, <)
+Base.argmax(arr::LogicalArray{<:NativeNumeric}) = _arg_reduce(ARGMAX_CODE, arr, >)
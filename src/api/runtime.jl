@@ -57,16 +57,57 @@ with the C++ runtime.
 """
 function create_library(name::String)
     rt = get_runtime()
-    lib = _create_library(rt, name) # cxxwrap call
-    # registers JuliaCustomTask::cpu_variant to legate runtime
-    _ufi_interface_register(lib) # cxxwrap call
-    request_ptr = _get_request_ptr()
-    # initialize async system to handle Julia task requests
-    _initialize_async_system(request_ptr) # cxxwrap call
+    lib = _timed_phase(:create_library) do
+        _create_library(rt, name) # cxxwrap call
+    end
+    _timed_phase(:register_ufi) do
+        # registers JuliaCustomTask::cpu_variant to legate runtime
+        _ufi_interface_register(lib) # cxxwrap call
+        request_ptr = _get_request_ptr()
+        # initialize async system to handle Julia task requests
+        _initialize_async_system(request_ptr) # cxxwrap call
+    end
     @debug "Registered library with C++ runtime"
     return lib
 end
 
+# Startup phases in the order they ran, with their wall-clock seconds
+const STARTUP_PHASES = Pair{Symbol,Float64}[]
+const STARTUP_LOCK = ReentrantLock()
+const STARTUP_T0 = Ref{UInt64}(0)
+
+function _record_phase(name::Symbol, seconds::Float64)
+    lock(STARTUP_LOCK) do
+        push!(STARTUP_PHASES, name => seconds)
+    end
+    return nothing
+end
+
+function _timed_phase(f, name::Symbol)
+    t = time_ns()
+    ret = f()
+    _record_phase(name, (time_ns() - t) / 1e9)
+    return ret
+end
+
+"""
+    startup_timings() -> Vector{Pair{Symbol,Float64}}
+
+Seconds spent in each startup phase, in the order the phases ran: `:dlopen` and
+`:start_legate` when the runtime starts, `:create_library` and `:register_ufi` per
+`create_library`, `:worker_handshake` and `:warm_up` when the UFI worker starts, and
+`:first_task`, the time from runtime start until the first Julia task finished.
+"""
+startup_timings() = lock(() -> copy(STARTUP_PHASES), STARTUP_LOCK)
+
+"""
+    native_library() -> Library
+
+Return the library holding Legate.jl's built-in native tasks (reductions, ...). It is
+created and its task variants registered on first use, independently of `create_library`.
+"""
+native_library() = _native_library() # cxxwrap call
+
 """
     time_microseconds() -> UInt64
 
@@ -0,0 +1,39 @@
+"""
+    scan(op::Symbol, arr::LogicalArray{T,1}) -> LogicalArray{T,1}
+
+Inclusive scan of `arr` with `op` (`:+`, `:*`, `:min` or `:max`). Each tile is scanned
+locally, then every tile folds in the totals of the tiles before it, so the work stays
+parallel and only one value per tile is exchanged. Results are accumulated in `T`.
+"""
+function scan(op::Symbol, arr::LogicalArray{T,1}) where {T<:NativeNumeric}
+    op in (:+, :*, :min, :max) ||
+        throw(ArgumentError("unsupported scan :$(op), expected one of :+, :*, :min, :max"))
+    out = _similar(arr)
+    _inclusive_scan(arr.handle, out.handle, REDUCE_CODES[op]) # cxxwrap call
+    return out
+end
+
+Base.cumsum(arr::LogicalArray{<:NativeNumeric,1}) = scan(:+, arr)
+Base.cumprod(arr::LogicalArray{<:NativeNumeric,1}) = scan(:*, arr)
+
+# Sorted values and their 1-based source positions
+function _sample_sort(arr::LogicalArray{T,1}) where {T<:NativeNumeric}
+    values = create_array(T)
+    indices = create_array(Int64)
+    _sample_sort(arr.handle, values.handle, indices.handle, Int64(1)) # cxxwrap call
+    # the outputs are unbound, but their length is known up front
+    dims = size(arr)
+    return LogicalArray{T,1}(values.handle, dims), LogicalArray{Int64,1}(indices.handle, dims)
+end
+
+"""
+    sort(arr::LogicalArray{T,1}) -> LogicalArray{T,1}
+    sortperm(arr::LogicalArray{T,1}) -> LogicalArray{Int64,1}
+
+Stable ascending sort of `arr`, or the permutation that sorts it, using a parallel sample
+sort: tiles are sorted locally to pick splitters, then each key moves only to the
+processor of its bucket, which merges the runs it receives. Values are ordered by
+`isless`, so `NaN`s come last.
+"""
+Base.sort(arr::LogicalArray{<:NativeNumeric,1}) = first(_sample_sort(arr))
+Base.sortperm(arr::LogicalArray{<:NativeNumeric,1}) = last(_sample_sort(arr))
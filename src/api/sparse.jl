@@ -0,0 +1,99 @@
+"""
+    CSRMatrix{T}
+
+A sparse matrix in compressed sparse row form, held in three `LogicalStore`s:
+- `pos`: for each row, the inclusive `Rect<1>` range of its nonzeros in `crd`/`vals`
+- `crd`: the zero-based column of each nonzero
+- `vals`: the value of each nonzero
+
+Multiply with `*` or [`spmv!`](@ref).
+"""
+struct CSRMatrix{T}
+    pos::LogicalStore{NTuple{2,Int64},1}
+    crd::LogicalStore{Int64,1}
+    vals::LogicalStore{T,1}
+    dims::NTuple{2,Int}
+end
+
+Base.size(A::CSRMatrix) = A.dims
+Base.size(A::CSRMatrix, i::Integer) = size(A)[i]
+Base.eltype(::CSRMatrix{T}) where {T} = T
+
+"""
+    nnz(A::CSRMatrix) -> Int
+
+Number of stored entries of `A`.
+"""
+nnz(A::CSRMatrix) = size(A.crd, 1)
+
+"""
+    CSRMatrix(m, n, rowptr, colval, nzval) -> CSRMatrix
+
+Build an `m × n` CSR matrix from 1-based CSR arrays: the nonzeros of row `i` are
+`nzval[rowptr[i]:rowptr[i+1]-1]`, in columns `colval[rowptr[i]:rowptr[i+1]-1]`.
+"""
+function CSRMatrix(
+    m::Integer, n::Integer,
+    rowptr::AbstractVector{<:Integer}, colval::AbstractVector{<:Integer},
+    nzval::AbstractVector{T},
+) where {T<:NativeNumeric}
+    length(rowptr) == m + 1 ||
+        throw(DimensionMismatch("rowptr has $(length(rowptr)) entries, expected $(m + 1)"))
+    k = length(nzval)
+    (length(colval) == k && rowptr[end] - 1 == k) ||
+        throw(DimensionMismatch("rowptr, colval and nzval describe different nonzero counts"))
+    all(c -> 1 <= c <= n, colval) || throw(ArgumentError("column index out of range 1:$(n)"))
+
+    pos = _csr_pos_from_rowptr(CxxWrap.StdVector(Int64[r - 1 for r in rowptr])) # cxxwrap call
+    crd = LogicalArray{Int64}(Int64[c - 1 for c in colval])
+    vals = LogicalArray{T}(collect(T, nzval))
+    return CSRMatrix{T}(
+        LogicalStore{NTuple{2,Int64},1}(pos, (Int(m),)),
+        LogicalStore{Int64,1}(data(crd.handle), (k,)),
+        LogicalStore{T,1}(data(vals.handle), (k,)),
+        (Int(m), Int(n)),
+    )
+end
+
+"""
+    CSRMatrix(A::AbstractMatrix) -> CSRMatrix
+
+Build a CSR matrix holding the nonzero entries of the dense matrix `A`.
+"""
+function CSRMatrix(A::AbstractMatrix{T}) where {T<:NativeNumeric}
+    m, n = size(A)
+    rowptr = Vector{Int64}(undef, m + 1)
+    colval = Int64[]
+    nzval = T[]
+    rowptr[1] = 1
+    for i in 1:m
+        for j in 1:n
+            if !iszero(A[i, j])
+                push!(colval, j)
+                push!(nzval, A[i, j])
+            end
+        end
+        rowptr[i + 1] = length(nzval) + 1
+    end
+    return CSRMatrix(m, n, rowptr, colval, nzval)
+end
+
+"""
+    spmv!(y::LogicalArray{T,1}, A::CSRMatrix{T}, x::LogicalArray{T,1}) -> y
+
+Compute `y = A * x` with the native SpMV task. Rows are split across processors, and the
+image constraints on `A`'s column store let each processor fetch only the entries of `x`
+its rows reference instead of the whole vector.
+"""
+function spmv!(y::LogicalArray{T,1}, A::CSRMatrix{T}, x::LogicalArray{T,1}) where {T}
+    m, n = size(A)
+    size(x, 1) == n || throw(DimensionMismatch("x has length $(size(x, 1)), expected $(n)"))
+    size(y, 1) == m || throw(DimensionMismatch("y has length $(size(y, 1)), expected $(m)"))
+    _spmv(A.pos.handle, A.crd.handle, A.vals.handle, data(x.handle), data(y.handle)) # cxxwrap call
+    return _written!(y)
+end
+
+function Base.:*(A::CSRMatrix{T}, x::LogicalArray{T,1}) where {T}
+    y = create_array([Int64(size(A, 1))], T)
+    return spmv!(y, A, x)
+end
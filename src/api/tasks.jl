@@ -13,29 +13,220 @@ function create_task(rt::CxxPtr{Runtime}, lib::Library, id::LocalTaskID, domain:
     return create_manual_task(rt, lib, id, domain)
 end
 
+"""
+    InflightWindow
+
+Bookkeeping for the cap on submitted-but-unfinished operations set by
+`set_inflight_limits!`. Operations are retired in batches: every `batch` submissions a
+marker task is issued behind an execution fence, and once it runs every operation of
+its batch is known to have finished.
+"""
+mutable struct InflightWindow
+    max_ops::Int
+    max_bytes::Int
+    batch::Int
+    # (marker sequence number, ops, bytes) of batches still in flight
+    marked::Vector{Tuple{UInt64,Int,Int}}
+    unmarked_ops::Int
+    unmarked_bytes::Int
+    ops::Int
+    bytes::Int
+    lock::ReentrantLock
+end
+
+const INFLIGHT = InflightWindow(
+    typemax(Int), typemax(Int), 1, Tuple{UInt64,Int,Int}[], 0, 0, 0, 0, ReentrantLock()
+)
+
+# estimated bytes written by tasks that have not been submitted yet; weak so a task that
+# is never submitted is not kept alive
+const TASK_BYTES = WeakKeyDict{Any,Int}()
+
+_limited(w::InflightWindow) = w.max_ops != typemax(Int) || w.max_bytes != typemax(Int)
+
+"""
+    set_inflight_limits!(; max_ops::Integer=typemax(Int), max_bytes::Integer=typemax(Int))
+
+Cap the number of submitted operations that may still be running, and the bytes of the
+arrays they write. Once either cap is reached, `submit_task` yields the calling Julia
+task until enough earlier operations finish, which keeps memory steady when the program
+submits work faster than it runs. The defaults disable both caps.
+
+Only operations submitted through `submit_task` count, and bytes are estimated from the
+bound outputs added with `add_output`.
+"""
+function set_inflight_limits!(; max_ops::Integer=typemax(Int), max_bytes::Integer=typemax(Int))
+    max_ops > 0 || throw(ArgumentError("max_ops must be positive"))
+    max_bytes > 0 || throw(ArgumentError("max_bytes must be positive"))
+    lock(INFLIGHT.lock) do
+        INFLIGHT.max_ops = max_ops
+        INFLIGHT.max_bytes = max_bytes
+        # two batches per window: one can retire while the next fills
+        INFLIGHT.batch = max_ops == typemax(Int) ? 64 : max(1, max_ops ÷ 2)
+    end
+    return nothing
+end
+
+"""
+    inflight() -> (ops = Int, bytes = Int)
+
+The operations, and their estimated output bytes, submitted but not known to have
+finished. Always zero while no cap is set.
+"""
+function inflight()
+    lock(INFLIGHT.lock) do
+        _retire!(INFLIGHT)
+        return (ops=INFLIGHT.ops, bytes=INFLIGHT.bytes)
+    end
+end
+
+function _mark!(w::InflightWindow)
+    w.unmarked_ops == 0 && return nothing
+    seq = _issue_marker() # cxxwrap call
+    push!(w.marked, (seq, w.unmarked_ops, w.unmarked_bytes))
+    w.unmarked_ops = 0
+    w.unmarked_bytes = 0
+    return nothing
+end
+
+function _retire!(w::InflightWindow)
+    isempty(w.marked) && return nothing
+    done = _completed_marker() # cxxwrap call
+    while !isempty(w.marked) && first(w.marked)[1] <= done
+        _, ops, bytes = popfirst!(w.marked)
+        w.ops -= ops
+        w.bytes -= bytes
+    end
+    return nothing
+end
+
+# Blocks (yielding) until an operation writing `bytes` fits in the window, then counts it.
+function _admit!(w::InflightWindow, bytes::Int)
+    spins = 0
+    while true
+        full = lock(w.lock) do
+            _retire!(w)
+            over = w.ops + 1 > w.max_ops || (w.ops > 0 && w.bytes + bytes > w.max_bytes)
+            if over
+                # whatever is still unmarked can only retire behind a marker
+                _mark!(w)
+            else
+                w.ops += 1
+                w.bytes += bytes
+                w.unmarked_ops += 1
+                w.unmarked_bytes += bytes
+            end
+            over
+        end
+        full || return nothing
+        spins = _backoff(spins)
+    end
+end
+
+# One step of a polling loop: let other Julia tasks run, and back off to a short sleep
+# once that has not been enough for a while. Returns the new spin count.
+function _backoff(spins::Int)
+    spins < 100 ? yield() : sleep(0.001)
+    return spins + 1
+end
+
+# Issues the marker for a full batch once the operation counted by `_admit!` is submitted.
+function _submitted!(w::InflightWindow)
+    lock(w.lock) do
+        w.unmarked_ops >= w.batch && _mark!(w)
+    end
+    return nothing
+end
+
+_task_bytes!(task) = pop!(TASK_BYTES, task, 0)
+
+# Generation of the last write to each array or store handle; weak so tracking a handle
+# does not keep it alive
+const WRITE_VERSIONS = WeakKeyDict{Any,UInt64}()
+const WRITE_EPOCH = Threads.Atomic{UInt64}(0)
+# Handle each view (`view`, `permutedims`, `project`, ...) was made from
+const VIEW_SOURCES = WeakKeyDict{Any,Any}()
+# Off until something needs versions, so plain writes skip the weak-dict bookkeeping
+const WRITE_TRACKING = Ref{Bool}(false)
+
+"""
+    track_writes!() -> Nothing
+
+Start recording `write_version`s. The first `launch_julia_task(...; memoize=true)` turns
+this on by itself; call it earlier when a memoized launch may read views made before that.
+"""
+track_writes!() = (WRITE_TRACKING[] = true; nothing)
+
+"""
+    write_version(x::Union{LogicalArray,LogicalStore}) -> UInt64
+
+Generation of the last write to `x` made through Legate.jl: task outputs and reductions,
+fills, `copyto!` and the in-place native operations. Equal values mean `x` was not
+written in between. A write through a view counts as a write to the arrays it was made
+from, and a view sees writes to them. Writes through raw inline mappings or handles
+made outside Legate.jl onto the same storage are not seen.
+
+Versions are only recorded once `track_writes!` has been called (or a memoized launch
+has been made); before that every array reports 0, and views made before then are not
+linked to their sources.
+"""
+function write_version(x::Union{LogicalArray,LogicalStore})
+    v, h = UInt64(0), x.handle
+    while !isnothing(h)
+        v = max(v, get(WRITE_VERSIONS, h, UInt64(0)))
+        h = get(VIEW_SOURCES, h, nothing)
+    end
+    return v
+end
+
+function _written!(x::Union{LogicalArray,LogicalStore})
+    WRITE_TRACKING[] || return x
+    v, h = Threads.atomic_add!(WRITE_EPOCH, UInt64(1)) + UInt64(1), x.handle
+    while !isnothing(h)
+        WRITE_VERSIONS[h] = v
+        h = get(VIEW_SOURCES, h, nothing)
+    end
+    return x
+end
+_written!(p::LogicalStorePartition) = (_written!(p.store); p)
+
+function _submit_throttled(f, task)
+    bytes = _task_bytes!(task)
+    _limited(INFLIGHT) || return f()
+    _admit!(INFLIGHT, bytes)
+    result = f()
+    _submitted!(INFLIGHT)
+    return result
+end
+
 """
     submit_task(rt::Runtime, AutoTask)
     submit_task(rt::Runtime, ManualTask)
 
-Submit an manual/auto task to the runtime.
+Submit an manual/auto task to the runtime. Yields first while the in-flight window set
+by `set_inflight_limits!` is full.
 """
 function submit_task(rt::CxxPtr{Runtime}, task::AutoTask)
     rt_ptr = Legate.get_obj_ptr(rt[])
     task_ptr = Legate.get_obj_ptr(task)
-    GC.@preserve rt task begin
-        Base.@threadcall(
-            :submit_auto_task, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), rt_ptr, task_ptr
-        )
+    _submit_throttled(task) do
+        GC.@preserve rt task begin
+            Base.@threadcall(
+                :submit_auto_task, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), rt_ptr, task_ptr
+            )
+        end
     end
 end
 
 function submit_task(rt::CxxPtr{Runtime}, task::ManualTask)
     rt_ptr = Legate.get_obj_ptr(rt[])
     task_ptr = Legate.get_obj_ptr(task)
-    GC.@preserve rt task begin
-        Base.@threadcall(
-            :submit_manual_task, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), rt_ptr, task_ptr
-        )
+    _submit_throttled(task) do
+        GC.@preserve rt task begin
+            Base.@threadcall(
+                :submit_manual_task, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), rt_ptr, task_ptr
+            )
+        end
     end
 end
 
@@ -100,9 +291,29 @@ function add_output(
     task::Union{AutoTask,ManualTask},
     item::Union{LogicalArray,LogicalStore,LogicalStorePartition},
 )
+    if _limited(INFLIGHT) && !(item isa LogicalStorePartition) && !isnothing(item.dims)
+        nbytes = prod(item.dims; init=1) * sizeof(eltype(item))
+        TASK_BYTES[task] = get(TASK_BYTES, task, 0) + nbytes
+    end
+    _written!(item)
     return add_output(task, item.handle)
 end
 
+"""
+    add_reduction(AutoTask, LogicalArray, op::ReductionOpKind) -> Variable
+    add_reduction(ManualTask, LogicalStore, op::ReductionOpKind)
+
+Add a logical array/store as a reduction argument of the task, folded with `op`.
+"""
+function add_reduction(
+    task::Union{AutoTask,ManualTask},
+    item::Union{LogicalArray,LogicalStore,LogicalStorePartition},
+    op::ReductionOpKind,
+)
+    _written!(item)
+    return add_reduction(task, item.handle, op)
+end
+
 """
     add_scalar(AutoTask, scalar::Scalar)
     add_scalar(ManualTask, scalar::Scalar)
@@ -108,6 +108,7 @@ end
 
 Base.size(s::LogicalStore) = s.dims
 Base.size(s::LogicalStore, i::Integer) = size(s)[i]
+Base.ndims(::LogicalStore{T,N}) where {T,N} = N
 
 """
     LogicalArray{T,N}
@@ -126,8 +127,49 @@ function LogicalArray{T,N}(handle::LogicalArrayImpl, dims) where {T,N}
     return LogicalArray{T,N}(handle, dims, :row)
 end
 
-Base.size(a::LogicalArray) = a.dims
+function Base.size(a::LogicalArray{T,N}) where {T,N}
+    isnothing(a.dims) || return a.dims
+    # unbound arrays get their shape from the producing task; this waits for it
+    s = shape(a.handle) # cxxwrap call
+    return ntuple(i -> Int(s[i]), Val(N))
+end
 Base.size(a::LogicalArray, i::Integer) = size(a)[i]
+Base.ndims(::LogicalArray{T,N}) where {T,N} = N
+
+"""
+    Future{T}
+
+A one-element, future-backed `LogicalStore` that a task launch reduces into with
+`redop`. Read the value with `fetch`, which waits only on the producers of this
+store instead of issuing an execution fence.
+"""
+struct Future{T}
+    store::LogicalStore{T,1}
+    redop::ReductionOpKind
+end
+
+# Element types a Julia task can reduce its return value into on the host
+const FutureElement = Union{Int8,Int16,Int32,Int64,UInt8,UInt16,UInt32,UInt64,Float32,Float64}
+
+"""
+    ReadyEvent
+
+Becomes ready once the operations that wrote an array, submitted before the event was
+created, have finished. Create one with `ready_event`; query it with `isready` and block
+on it with `wait`.
+"""
+mutable struct ReadyEvent
+    ticket::UInt64
+    done::Bool
+end
+
+"""
+    ReductionOpKind
+
+Reduction operator applied to reduction arguments and task return values
+(`REDOP_ADD`, `REDOP_MUL`, `REDOP_MAX`, `REDOP_MIN`, `REDOP_OR`, `REDOP_AND`, `REDOP_XOR`).
+"""
+ReductionOpKind
 
 """
     LegateType
@@ -139,8 +181,10 @@ LegateType
 """
     LogicalStorePartition{T,N}
 Represents a tiled partition of a `LogicalStore`. Created via `partition_by_tiling`.
-Wraps the underlying C++ `LogicalStorePartitionImpl`.
+Wraps the underlying C++ `LogicalStorePartitionImpl` and keeps the partitioned store, so
+writes through the partition count as writes to it.
 """
 struct LogicalStorePartition{T,N}
     handle::CxxWrap.StdLib.SharedPtr{LogicalStorePartitionImpl}
+    store::LogicalStore{T,N}
 end
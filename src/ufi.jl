@@ -17,18 +17,34 @@
  *            Ethan Meitz <emeitz@andrew.cmu.edu>
  =#
 
-export JuliaGPUTask, JuliaCPUTask, JuliaTask, TaskArgument, TaskRequest
+export JuliaGPUTask, JuliaCPUTask, JuliaTask, TaskArgument, TaskRequest, UnboundOutput
+
+"""
+    UnboundOutput{T}
+
+Task argument standing in for an unbound output. The task decides its size at run
+time with `create_output_buffer`; Legate concatenates the per-point pieces.
+"""
+struct UnboundOutput{T}
+    index::Int # 0-based output index within the launch
+    nullable::Bool
+end
 
 # Legate scalar types + AbstractArray for tasks
-const TaskArgument = Union{AbstractArray,SUPPORTED_TYPES}
+const TaskArgument = Union{AbstractArray,SUPPORTED_TYPES,UnboundOutput}
 
 const CPUWrapType = FunctionWrapper{Nothing,Tuple{Vector{TaskArgument}}}
+# Tasks that return a value reduced into a `Future`
+const CPURetWrapType = FunctionWrapper{Any,Tuple{Vector{TaskArgument}}}
 
 struct JuliaCPUTask
-    fun::CPUWrapType
+    fun::Union{CPUWrapType,CPURetWrapType}
     task_id::UInt32
+    return_type::Union{Nothing,DataType}
 end
 
+JuliaCPUTask(fun, task_id) = JuliaCPUTask(fun, task_id, nothing)
+
 struct JuliaGPUTask
     fun::Function
     task_id::UInt32
@@ -36,18 +52,38 @@ end
 
 JuliaTask = Union{JuliaCPUTask,JuliaGPUTask}
 
-function wrap_task(f; task_type=:cpu)
+"""
+    wrap_task(f; task_type=:cpu, return_type=nothing) -> JuliaTask
+
+Wrap `f(args::Vector{TaskArgument})` as a Julia task. When `return_type` is set, the value
+returned by each point task is converted to `return_type` and reduced into the `Future`
+passed as `result` to `create_julia_task`.
+
+CPU task functions are compiled for `Vector{TaskArgument}` here, so the first launch does
+not stall the UFI worker on compilation.
+"""
+function wrap_task(f; task_type=:cpu, return_type::Union{Nothing,DataType}=nothing)
     task_id = Threads.atomic_add!(NEXT_TASK_ID, UInt32(1))
     if task_type == :gpu
         return JuliaGPUTask(f, task_id)
-    else
+    end
+    precompile(f, (Vector{TaskArgument},))
+    if isnothing(return_type)
         return JuliaCPUTask(CPUWrapType(f), task_id)
+    else
+        return JuliaCPUTask(CPURetWrapType(f), task_id, return_type)
     end
 end
 
 # Thread-safe execution from Legate worker threads
 # Signals via uv_async_send, Julia executes
 
+# uid and element size of an array argument, for STRUCT/FIXED_ARRAY/BINARY types
+struct ArgTypeInfo
+    uid::UInt32
+    size::UInt32
+end
+
 # Shared data structure for passing task information from C++ to Julia
 struct TaskRequest
     is_gpu::Cint # Use Cint for better alignment
@@ -63,15 +99,113 @@ struct TaskRequest
     num_scalars::Csize_t
     ndim::Cint
     dims::NTuple{3,Int64}
+    return_ptr::Ptr{Cvoid} # C_NULL unless the launch reduces a return value
+    return_type::Cint
+    outputs_unbound::Ptr{Cint}
+    inputs_null_mask::Ptr{Ptr{Cvoid}} # C_NULL entries for non-nullable arguments
+    outputs_null_mask::Ptr{Ptr{Cvoid}}
+    num_threads::Cint # cores owned by the point task (>1 for OpenMP variants)
+    comm_rank::Cint # rank in the launch's CPU communicator
+    comm_size::Cint # 0 when the launch has no CPU communicator
+    numa_node::Cint # NUMA node of the calling processor, -1 if unknown
+    inputs_type_info::Ptr{ArgTypeInfo}
+    outputs_type_info::Ptr{ArgTypeInfo}
+    scalar_type_info::Ptr{ArgTypeInfo}
+    inputs_strides::Ptr{Int64} # 3 element strides per argument, -1 if packed
+    outputs_strides::Ptr{Int64}
 
     function TaskRequest()
-        new(0, 0, C_NULL, C_NULL, C_NULL, C_NULL, C_NULL, C_NULL, 0, 0, 0, 0, (0, 0, 0))
+        new(
+            0, 0, C_NULL, C_NULL, C_NULL, C_NULL, C_NULL, C_NULL, 0, 0, 0, 0, (0, 0, 0),
+            C_NULL, 0, C_NULL, C_NULL, C_NULL, 1, 0, 0, -1, C_NULL, C_NULL, C_NULL, C_NULL,
+            C_NULL,
+        )
     end
 end
 
+
+# Layout of a STRING or LIST input as handed over by C++
+struct VarSizeView
+    ranges::Ptr{NTuple{2,Int64}} # inclusive [lo, hi] per element
+    data::Ptr{Cvoid}
+    length::Int64
+    data_lo::Int64
+    data_length::Int64
+    data_type::Cint
+    data_uid::UInt32
+    data_size::UInt32
+end
+
+"""
+    VarSizeVector{E}
+
+A STRING or LIST array passed to a Julia task. Element `i` is a view of the payload
+`Vector{E}` read in place, with no copies. String payloads are `UInt8` code units:
+`String(v[i])` makes a copy. Only valid until the task returns.
+"""
+struct VarSizeVector{E} <: AbstractVector{SubArray{E,1,Vector{E},Tuple{UnitRange{Int}},true}}
+    ranges::Vector{NTuple{2,Int64}}
+    data::Vector{E}
+    base::Int64
+end
+
+Base.size(v::VarSizeVector) = size(v.ranges)
+Base.IndexStyle(::Type{<:VarSizeVector}) = IndexLinear()
+
+Base.@propagate_inbounds function Base.getindex(v::VarSizeVector, i::Int)
+    lo, hi = v.ranges[i]
+    return view(v.data, (lo - v.base + 1):(hi - v.base + 1))
+end
+
+"""
+    payload(v::VarSizeVector) -> Vector
+
+The flat payload behind all elements of `v`, for kernels that scan it in one pass.
+"""
+payload(v::VarSizeVector) = v.data
+
+"""
+    StridedTaskArray{T,N}
+
+An array argument whose tile is not dense in row-major order, e.g. a transposed, projected
+or broadcast view of a `LogicalArray`. Reads and writes go straight to the mapped
+instance. Like a dense argument, linear index `k` is the `k`-th element of the tile in
+Legate's row-major order, so kernels can mix both freely. Only valid until the task
+returns.
+"""
+struct StridedTaskArray{T,N} <: AbstractArray{T,N}
+    ptr::Ptr{T}
+    dims::NTuple{N,Int}
+    strides::NTuple{N,Int} # element strides of the Legate dimensions
+end
+
+Base.size(a::StridedTaskArray) = a.dims
+Base.IndexStyle(::Type{<:StridedTaskArray}) = IndexLinear()
+
+@inline function _offset(a::StridedTaskArray{T,N}, i::Int) where {T,N}
+    k, off = i - 1, 0
+    for d in N:-1:1
+        k, r = divrem(k, a.dims[d])
+        off += r * a.strides[d]
+    end
+    return off
+end
+
+Base.@propagate_inbounds function Base.getindex(a::StridedTaskArray, i::Int)
+    @boundscheck checkbounds(a, i)
+    return unsafe_load(a.ptr, _offset(a, i) + 1)
+end
+
+Base.@propagate_inbounds function Base.setindex!(a::StridedTaskArray, x, i::Int)
+    @boundscheck checkbounds(a, i)
+    unsafe_store!(a.ptr, x, _offset(a, i) + 1)
+    return a
+end
+
 # Thread-safe task registry
-# Union{CPUWrapType,Function} to allow storing both CPU FunctionWrappers and GPU kernel functions
-const TASK_REGISTRY = Dict{UInt32,Union{CPUWrapType,Function}}()
+# Union{CPUWrapType,CPURetWrapType,Function} to allow storing both CPU FunctionWrappers and GPU kernel functions
+const TaskFunction = Union{CPUWrapType,CPURetWrapType,Function}
+const TASK_REGISTRY = Dict{UInt32,TaskFunction}()
 const REGISTRY_LOCK = ReentrantLock()
 
 # Atomic counter for auto-generating task IDs
@@ -84,7 +218,7 @@ const ALL_TASKS_DONE = Threads.Condition()
 # Track if UFI has been shut down
 const UFI_SHUTDOWN_DONE = Threads.Atomic{Bool}(false)
 
-function register_task_function(id::UInt32, fun::Union{CPUWrapType,Function})
+function register_task_function(id::UInt32, fun::TaskFunction)
     lock(REGISTRY_LOCK) do
         TASK_REGISTRY[id] = fun
     end
@@ -92,7 +226,7 @@ function register_task_function(id::UInt32, fun::Union{CPUWrapType,Function})
 end
 
 @doc"""
-    create_julia_task(rt::Runtime, lib::Library, task_obj::JuliaTask) -> AutoTask
+    create_julia_task(rt::Runtime, lib::Library, task_obj::JuliaTask; result=nothing) -> AutoTask
 
 Create a Julia task in the runtime.
 
@@ -100,21 +234,273 @@ Create a Julia task in the runtime.
 - `rt`: The current runtime instance.
 - `lib`: The library to associate with the task.
 - `task_obj`: The Julia task object to register.
+
+# Keywords
+- `result`: A `Future` that the values returned by each point task are reduced into.
+  `task_obj` must have been wrapped with a matching `return_type`.
 """
 function create_julia_task(
-    rt::CxxPtr{Runtime}, lib::Library, task_obj::JuliaCPUTask
+    rt::CxxPtr{Runtime}, lib::Library, task_obj::JuliaCPUTask;
+    result::Union{Nothing,Future}=nothing,
 )
+    isnothing(result) && !isnothing(task_obj.return_type) &&
+        throw(ArgumentError("task returns $(task_obj.return_type) but no `result` was given"))
     task = create_task(rt, lib, JULIA_CUSTOM_TASK)
     add_scalar(task, Scalar(task_obj.task_id))
+    if isnothing(result)
+        add_scalar(task, Scalar(NO_RETURN))
+    else
+        add_return(task, task_obj, result)
+    end
     register_task_function(task_obj.task_id, task_obj.fun)
     return task
 end
 
+# Scalar 1 of every Julia task is the reduction applied to its per-point return values,
+# or NO_RETURN. It is added straight after the task ID and before any user scalars, and
+# tells the task which reduction store is the return slot.
+const NO_RETURN = Int32(-1)
+
+function add_return(task::AutoTask, task_obj::JuliaCPUTask, result::Future{T}) where {T}
+    task_obj.return_type === T || throw(
+        ArgumentError("task returns $(task_obj.return_type) but result is a Future{$T}"),
+    )
+    add_scalar(task, Scalar(Int32(result.redop)))
+    add_reduction(task, result.store, result.redop)
+    return nothing
+end
+
 # in CUDAExt ufi.jl
 # function create_julia_task(
 #     rt::CxxPtr{Runtime}, lib::Library, task_obj::JuliaGPUTask
 # ) end
 
+# Launches whose largest array has at most this many elements run inline (0 disables)
+const EAGER_THRESHOLD = Ref{Int}(0)
+
+"""
+    set_eager_threshold!(n::Integer)
+
+Run `launch_julia_task` launches whose arrays all have at most `n` elements directly on
+the calling thread instead of through a Legate task. `0` (the default) disables this.
+"""
+set_eager_threshold!(n::Integer) = (EAGER_THRESHOLD[] = Int(n); nothing)
+
+"""
+    launch_julia_task(rt, lib, task_obj::JuliaCPUTask, inputs, outputs;
+                      scalars=(), eager=nothing, collective=false)
+
+Create, align (`default_alignment`) and submit a Julia task over `inputs` and `outputs`,
+passing `scalars` after them. Isbits structs and tuples among `scalars` travel as one
+`compound_scalar` each and reach the task as values of their own type.
+
+Small launches can skip the `AutoTask`, partitioning and UFI handoff: with `eager=true`,
+or with `eager=nothing` and every array at most `set_eager_threshold!` elements, the task
+function runs on the calling thread against inline-mapped arrays. Inline mappings wait on
+the producers of each array and later launches are ordered after them, so program order
+is kept. Launches with unbound outputs always go through Legate. STRING and LIST arrays
+can only be inputs: a task has no way to size their payload, so passing one as an output
+throws an `ArgumentError`.
+
+`collective=true` attaches a CPU communicator to the launch so the task body can call
+`allgather!`, `allreduce!` and `bcast!`; see `task_rank`.
+
+`memoize=true` opts into the result cache described in `memo_stats` and makes the call
+return the arrays holding the results: `outputs` on a miss, or on a hit the outputs of the
+earlier launch, with nothing submitted and `outputs` left untouched. Only memoize tasks
+whose outputs depend on nothing but their inputs and scalars.
+"""
+function launch_julia_task(
+    rt::CxxPtr{Runtime}, lib::Library, task_obj::JuliaCPUTask,
+    inputs::Vector{<:LogicalArray}, outputs::Vector{<:LogicalArray};
+    scalars=(), eager::Union{Nothing,Bool}=nothing, collective::Bool=false,
+    memoize::Bool=false,
+)
+    for a in outputs
+        # variable-size elements are only wrapped for reading
+        T = eltype(a)
+        (T === String || T <: Vector) &&
+            throw(ArgumentError("$T arrays can be task inputs but not outputs"))
+    end
+    launch() = _launch_julia_task(rt, lib, task_obj, inputs, outputs, scalars, eager, collective)
+    memoize || return launch()
+    track_writes!()
+    key = _memo_key(task_obj, inputs, scalars)
+    cached = _memo_lookup(key, inputs)
+    isnothing(cached) || return cached
+    launch()
+    _memo_store!(key, inputs, outputs)
+    return outputs
+end
+
+function _launch_julia_task(rt, lib, task_obj, inputs, outputs, scalars, eager, collective)
+    if _run_eagerly(eager, inputs, outputs)
+        return execute_inline(task_obj, inputs, outputs, scalars)
+    end
+    task = create_julia_task(rt, lib, task_obj)
+    collective && add_communicator(task, "cpu") # cxxwrap call
+    in_vars = Vector{Variable}([add_input(task, a) for a in inputs])
+    out_vars = Vector{Variable}([add_output(task, a) for a in outputs])
+    default_alignment(task, in_vars, out_vars)
+    for s in scalars
+        add_scalar(task, to_scalar(s))
+    end
+    submit_task(rt, task)
+    return nothing
+end
+
+# Cached outputs of one memoized launch. The inputs are held weakly, to tell a reused
+# objectid from the original handle without keeping the inputs alive.
+struct MemoEntry
+    inputs::Vector{WeakRef}
+    outputs::Vector{LogicalArray}
+    output_versions::Vector{UInt64}
+    bytes::Int
+end
+
+mutable struct MemoCache
+    entries::Dict{Tuple{UInt32,Vector{UInt8},Vector{NTuple{2,UInt64}}},MemoEntry}
+    order::Vector{Tuple{UInt32,Vector{UInt8},Vector{NTuple{2,UInt64}}}} # oldest first
+    capacity::Int
+    hits::Int
+    misses::Int
+    bytes_saved::Int
+    lock::ReentrantLock
+end
+
+const MEMO = MemoCache(Dict(), [], 256, 0, 0, 0, ReentrantLock())
+
+"""
+    memo_stats() -> NamedTuple
+
+Counters of the cache used by `launch_julia_task(...; memoize=true)`: `hits`, `misses`,
+`entries` and `bytes_saved`, the output bytes hits did not recompute. A launch hits when
+the same wrapped task was launched before with byte-identical scalars and the very same
+input handles, none of which has been written since (see `write_version`), and its cached
+outputs have not been written since either.
+"""
+function memo_stats()
+    lock(MEMO.lock) do
+        return (
+            hits=MEMO.hits, misses=MEMO.misses, entries=length(MEMO.entries),
+            bytes_saved=MEMO.bytes_saved,
+        )
+    end
+end
+
+"""
+    clear_memo!(; capacity::Integer=MEMO.capacity)
+
+Drop every cached result and reset the counters of `memo_stats`. `capacity` bounds the
+number of cached launches; the oldest is evicted first.
+"""
+function clear_memo!(; capacity::Integer=MEMO.capacity)
+    capacity > 0 || throw(ArgumentError("capacity must be positive"))
+    lock(MEMO.lock) do
+        empty!(MEMO.entries)
+        empty!(MEMO.order)
+        MEMO.capacity = capacity
+        MEMO.hits = MEMO.misses = MEMO.bytes_saved = 0
+    end
+    return nothing
+end
+
+function _memo_key(task_obj::JuliaCPUTask, inputs, scalars)
+    io = IOBuffer()
+    for s in scalars
+        write(io, hash(typeof(s)))
+        s isa AbstractString ? write(io, s) : write(io, Ref(s))
+    end
+    versions = [(UInt64(objectid(a.handle)), write_version(a)) for a in inputs]
+    return (task_obj.task_id, take!(io), versions)
+end
+
+function _memo_lookup(key, inputs)
+    lock(MEMO.lock) do
+        entry = get(MEMO.entries, key, nothing)
+        if !isnothing(entry) &&
+            all(((w, a),) -> w.value === a.handle, zip(entry.inputs, inputs)) &&
+            map(write_version, entry.outputs) == entry.output_versions
+            MEMO.hits += 1
+            MEMO.bytes_saved += entry.bytes
+            return entry.outputs
+        end
+        MEMO.misses += 1
+        return nothing
+    end
+end
+
+function _memo_store!(key, inputs, outputs)
+    bytes = sum(outputs; init=0) do a
+        isnothing(a.dims) ? 0 : prod(a.dims; init=1) * sizeof(eltype(a))
+    end
+    entry = MemoEntry(
+        [WeakRef(a.handle) for a in inputs], collect(LogicalArray, outputs),
+        map(write_version, outputs), bytes,
+    )
+    lock(MEMO.lock) do
+        haskey(MEMO.entries, key) || push!(MEMO.order, key)
+        MEMO.entries[key] = entry
+        while length(MEMO.order) > MEMO.capacity
+            delete!(MEMO.entries, popfirst!(MEMO.order))
+        end
+    end
+    return nothing
+end
+
+function _run_eagerly(eager, inputs, outputs)
+    any(a -> isnothing(a.dims), outputs) && return false
+    # the inline launch has no partitioning, so every argument must cover the same shape
+    arrays = Iterators.flatten((inputs, outputs))
+    allequal(size(a) for a in arrays) || return false
+    # inline mappings are only wrapped for primitive element types
+    all(a -> haskey(type_map, eltype(a)), arrays) || return false
+    isnothing(eager) || return eager
+    threshold = EAGER_THRESHOLD[]
+    threshold > 0 || return false
+    return all(a -> prod(size(a)) <= threshold, arrays)
+end
+
+# Inline-maps each array in SYSMEM and wraps it the same way the UFI worker would.
+function _inline_argument(arr::LogicalArray{T}, phys) where {T}
+    ptr = Ptr{T}(get_ptr(phys))
+    mask = nullable(arr) ? get_ptr(null_mask(phys)) : C_NULL
+    return _wrap_argument(ptr, mask, size(arr), Tuple(element_strides(data(phys))))
+end
+
+"""
+    execute_inline(task_obj::JuliaCPUTask, inputs, outputs, scalars)
+
+Run `task_obj` on the calling thread over inline mappings of `inputs` and `outputs`,
+bypassing the Legate task launch. Used by `launch_julia_task` for small launches.
+"""
+function execute_inline(task_obj::JuliaCPUTask, inputs, outputs, scalars)
+    isnothing(task_obj.return_type) ||
+        throw(ArgumentError("tasks with return values cannot run inline"))
+    arrays = vcat(inputs, outputs)
+    isempty(arrays) && return nothing
+    allequal(size(a) for a in arrays) ||
+        throw(DimensionMismatch("inline launches need arguments of one shape"))
+    phys = [get_physical_array(a, SYSMEM) for a in arrays]
+    args = Vector{TaskArgument}()
+    sizehint!(args, length(arrays) + length(scalars))
+    for (a, p) in zip(arrays, phys)
+        push!(args, _inline_argument(a, p))
+    end
+    append!(args, scalars)
+    TASK_NTHREADS[] = 1
+    TASK_COMM[] = (0, 0)
+    TASK_NUMA_NODE[] = -1
+    RUNNING_INLINE[] = true
+    try
+        GC.@preserve phys Base.invokelatest(task_obj.fun, args)
+    finally
+        RUNNING_INLINE[] = false
+    end
+    foreach(_written!, outputs)
+    return nothing
+end
+
 # Global state
 # We use a Ref{TaskRequest} to provide stable memory for C++
 # Ref{T} for bits types (immutable structs) holds the data inline.
@@ -122,7 +508,7 @@ const CURRENT_REQUEST = Ref{TaskRequest}()
 
 # Worker task that waits for async signals from C++
 function async_worker()
-    WORKER_STARTED[] = true
+    notify(WORKER_READY)
     @debug "Legate UFI: Worker started on thread $(Threads.threadid())"
     try
         while !UFI_SHUTDOWN_DONE[]
@@ -154,28 +540,324 @@ function _execute_julia_task(::Val{:cpu}, req, task_fun)
     dims = ntuple(i -> req.dims[i], Int(req.ndim))
     for i in 1:req.num_inputs
         type_code = unsafe_load(req.inputs_types, i)
-        T = get_code_type(type_code)
+        mask = unsafe_load(req.inputs_null_mask, i)
+        if type_code == Int(STRING) || type_code == Int(LIST)
+            vs = unsafe_load(Ptr{VarSizeView}(unsafe_load(req.inputs_ptr, i)))
+            push!(args, _wrap_argument(_var_size_vector(vs, type_code), mask))
+            continue
+        end
+        T = _argument_type(type_code, unsafe_load(req.inputs_type_info, i))
         ptr = Ptr{T}(unsafe_load(req.inputs_ptr, i))
-        push!(args, unsafe_wrap(Array, ptr, dims))
+        strides = _argument_strides(req.inputs_strides, i, dims)
+        push!(args, _wrap_argument(ptr, mask, dims, strides))
     end
 
     for i in 1:req.num_outputs
         type_code = unsafe_load(req.outputs_types, i)
-        T = get_code_type(type_code)
+        T = _argument_type(type_code, unsafe_load(req.outputs_type_info, i))
+        unbound = unsafe_load(req.outputs_unbound, i) # 1 = unbound, 2 = unbound + nullable
+        if unbound != 0
+            push!(args, UnboundOutput{T}(i - 1, unbound == 2))
+            continue
+        end
         ptr = Ptr{T}(unsafe_load(req.outputs_ptr, i))
-        push!(args, unsafe_wrap(Array, ptr, dims))
+        mask = unsafe_load(req.outputs_null_mask, i)
+        strides = _argument_strides(req.outputs_strides, i, dims)
+        push!(args, _wrap_argument(ptr, mask, dims, strides))
     end
 
     for i in 1:req.num_scalars
         type_code = Int(unsafe_load(req.scalar_types, i))
-        T = get_code_type(type_code)
+        T = _argument_type(type_code, unsafe_load(req.scalar_type_info, i))
         val_ptr = unsafe_load(req.scalars_ptr, i)
         val = unsafe_load(Ptr{T}(val_ptr))
         push!(args, val)
     end
 
     cpu_args = Vector{TaskArgument}(args)
-    task_fun(cpu_args)
+    ret = task_fun(cpu_args)
+    req.return_ptr == C_NULL || _store_return(req, ret)
+end
+
+# Nullable arguments become a MaskedArray over the data and null mask (no copies)
+function _wrap_argument(ptr::Ptr, mask::Ptr{Cvoid}, dims)
+    return _wrap_argument(unsafe_wrap(Array, ptr, dims), mask)
+end
+
+function _wrap_argument(arr::AbstractArray, mask::Ptr{Cvoid})
+    mask == C_NULL && return arr
+    return MaskedArray(arr, unsafe_wrap(Array, Ptr{Bool}(mask), size(arr)))
+end
+
+# Views of a LogicalArray arrive with the strides of their source's instance. The null
+# mask is a store with the same transforms and instance layout, so it shares them.
+function _wrap_argument(ptr::Ptr{T}, mask::Ptr{Cvoid}, dims, strides) where {T}
+    if isnothing(strides) || _is_row_major(strides, dims)
+        return _wrap_argument(ptr, mask, dims)
+    end
+    arr = StridedTaskArray{T,length(dims)}(ptr, dims, strides)
+    mask == C_NULL && return arr
+    return MaskedArray(arr, StridedTaskArray{Bool,length(dims)}(Ptr{Bool}(mask), dims, strides))
+end
+
+# -1 marks arguments C++ could not give strides for (empty tiles)
+function _argument_strides(strides::Ptr{Int64}, i, dims)
+    strides == C_NULL && return nothing
+    s = ntuple(d -> Int(unsafe_load(strides, 3 * (i - 1) + d)), length(dims))
+    return any(<(0), s) ? nothing : s
+end
+
+const COMPOUND_CODES = (Int(STRUCT), Int(FIXED_ARRAY), Int(BINARY))
+
+# Compound elements come back as the Julia type they were built from (`compound_type`),
+# or as raw bytes when the type was built outside Julia.
+function _argument_type(type_code, info::ArgTypeInfo)
+    Int(type_code) in COMPOUND_CODES || return get_code_type(type_code)
+    T = compound_julia_type(info.uid)
+    return isnothing(T) ? NTuple{Int(info.size),UInt8} : T
+end
+
+function _var_size_vector(vs::VarSizeView, type_code)
+    E = if type_code == Int(STRING)
+        UInt8 # Legate stores characters as INT8
+    else
+        _argument_type(vs.data_type, ArgTypeInfo(vs.data_uid, vs.data_size))
+    end
+    n, m = Int(vs.length), Int(vs.data_length)
+    ranges = n == 0 ? NTuple{2,Int64}[] : unsafe_wrap(Array, vs.ranges, n)
+    data = m == 0 ? E[] : unsafe_wrap(Array, Ptr{E}(vs.data), m)
+    return VarSizeVector{E}(ranges, data, vs.data_lo)
+end
+
+function _store_return(req::TaskRequest, ret)
+    T = get_code_type(Int(req.return_type))
+    unsafe_store!(Ptr{T}(req.return_ptr), convert(T, ret))
+end
+
+"""
+    create_output_buffer(out::UnboundOutput{T}, n::Integer) -> Vector{T}
+
+Allocate the `n`-element buffer backing an unbound output from inside a Julia task and
+bind it to the output. The returned `Vector` (a `MaskedArray` for nullable outputs)
+aliases Legate memory (no copy) and is only valid until the task returns. Each unbound
+output can be given one buffer per point task; outputs left without one contribute no
+elements.
+"""
+function create_output_buffer(out::UnboundOutput{T}, n::Integer) where {T}
+    n >= 0 || throw(ArgumentError("output buffer size must be non-negative, got $n"))
+    _check_in_task(:create_output_buffer)
+    ptr = Ref{Ptr{Cvoid}}(C_NULL)
+    mask = Ref{Ptr{Cvoid}}(C_NULL)
+    ok = ccall(
+        :legate_create_output_buffer, Cint,
+        (Csize_t, Int64, Ptr{Ptr{Cvoid}}, Ptr{Ptr{Cvoid}}),
+        out.index, n, ptr, mask,
+    )
+    ok == 0 && error("Legate UFI: could not create a buffer for unbound output $(out.index)")
+    data = unsafe_wrap(Array, Ptr{T}(ptr[]), Int(n))
+    out.nullable || return data
+    return MaskedArray(data, unsafe_wrap(Array, Ptr{Bool}(mask[]), Int(n)))
+end
+
+# True while `execute_inline` runs a task body outside of any Legate task
+const RUNNING_INLINE = Ref{Bool}(false)
+
+# Service requests are answered by the thread running the Legate task, so they only make
+# sense from inside a Julia task body
+function _check_in_task(fname::Symbol)
+    ccall(:legate_task_active, Cint, ()) != 0 ||
+        error("Legate UFI: $(fname) can only be called from inside a running Julia task")
+    return nothing
+end
+
+"""
+    scratch_buffer(T::Type, dims::Integer...) -> Array{T}
+
+Task-local workspace allocated by Legate (`legate::create_buffer`) in the memory closest
+to the processor running the task, instead of by the Julia GC. The returned `Array`
+aliases that memory and is only valid until the task returns, so it must not escape the
+task. Only the small `Array` header is GC-allocated, which keeps steady-state kernels from
+triggering collections that would stall the UFI worker.
+"""
+function scratch_buffer(::Type{T}, dims::Integer...) where {T}
+    isbitstype(T) || throw(ArgumentError("scratch buffers need an isbits element type, got $T"))
+    shape = map(Int, dims)
+    n = prod(shape; init=1)
+    # inline tasks have no Legate task to allocate from
+    (n == 0 || RUNNING_INLINE[]) && return Array{T}(undef, shape)
+    _check_in_task(:scratch_buffer)
+    ptr = Ref{Ptr{Cvoid}}(C_NULL)
+    ok = ccall(
+        :legate_create_scratch_buffer, Cint,
+        (Int64, Csize_t, Ptr{Ptr{Cvoid}}),
+        n * sizeof(T), Base.datatype_alignment(T), ptr,
+    )
+    ok == 0 && error("Legate UFI: could not allocate a $(n * sizeof(T))-byte scratch buffer")
+    return unsafe_wrap(Array, Ptr{T}(ptr[]), shape)
+end
+
+# Cores owned by the point task currently executing on the worker
+const TASK_NTHREADS = Ref{Int}(1)
+
+"""
+    task_nthreads() -> Int
+
+Number of cores owned by the running Julia task. Point tasks launched on an OpenMP
+processor own a whole group of cores; CPU point tasks own one.
+"""
+task_nthreads() = TASK_NTHREADS[]
+
+"""
+    parallel_chunks(f, r::AbstractUnitRange)
+
+Split `r` into `task_nthreads()` contiguous chunks and run `f(chunk)` on each in its own
+Julia task, letting one launch use all the cores its processor owns. Runs `f(r)` inline
+when the task owns a single core. The chunks run on Julia's thread pool, not on the
+OpenMP group's cores, and never on the main thread, which may be blocked waiting on this
+very task. The count is therefore also capped at `Threads.nthreads() - 1`: start Julia
+with more threads than `--ompthreads` to use the whole group. Each chunk stays on one
+thread, pinned to the task's NUMA node while it runs the chunk and released afterwards,
+since pool threads also run unrelated Julia tasks (see `set_numa_binding!`).
+"""
+function parallel_chunks(f, r::AbstractUnitRange)
+    tids = filter(!=(1), Threads.threadpooltids(:default))
+    n = min(task_nthreads(), length(tids), length(r))
+    n <= 1 && return f(r)
+    node = TASK_NUMA_NODE[]
+    chunks = Iterators.partition(r, cld(length(r), n))
+    tasks = map(zip(tids, chunks)) do (tid, chunk)
+        _spawn_sticky(tid) do
+            _bind_numa(node)
+            try
+                f(chunk)
+            finally
+                _bind_numa(-1)
+            end
+        end
+    end
+    foreach(wait, tasks)
+    return nothing
+end
+
+# Run `f` on Julia thread `tid` in a sticky task. The NUMA pinning is per thread and is
+# saved and restored per thread, so a chunk that yields inside `f` must not resume on
+# another thread, which `Threads.@spawn` would allow.
+function _spawn_sticky(f, tid::Integer)
+    t = Task(f)
+    t.sticky = true
+    ccall(:jl_set_task_tid, Cint, (Any, Cint), t, tid - 1)
+    return schedule(t)
+end
+
+# NUMA node of the Legate processor that launched the running point task, -1 if unknown
+const TASK_NUMA_NODE = Ref{Int}(-1)
+const NUMA_BINDING = Ref{Bool}(true)
+
+"""
+    set_numa_binding!(on::Bool)
+
+Choose whether Julia threads running task bodies are pinned to the cores of the NUMA node
+of the Legate processor that launched the task (on by default). The Legate processor's
+instances live in memory local to that node, so without pinning a kernel scheduled on the
+other socket reads every tile across the interconnect. Turning it off releases each
+thread's pinning the next time it runs a task. A no-op on single-node machines.
+"""
+set_numa_binding!(on::Bool) = (NUMA_BINDING[] = on; nothing)
+
+"""
+    task_numa_node() -> Int
+
+NUMA node the running Julia task is placed on, or -1 when unknown (single-node machines,
+GPU tasks and inline runs).
+"""
+task_numa_node() = TASK_NUMA_NODE[]
+
+# Pin the calling thread to `node`, or release it when binding is off
+function _bind_numa(node::Integer)
+    target = NUMA_BINDING[] ? node : -1
+    return ccall(:legate_bind_numa_node, Cint, (Cint,), target) != 0
+end
+
+# (rank, size) of the running point task in its launch's CPU communicator; size 0 if none
+const TASK_COMM = Ref{NTuple{2,Int}}((0, 0))
+
+"""
+    task_rank() -> Int
+    task_ranks() -> Int
+
+Rank of the running Julia task within its launch's CPU communicator, and the number of
+ranks. Launches without `collective=true` (and inline runs) report rank 0 of 1.
+"""
+task_rank() = TASK_COMM[][1]
+task_ranks() = max(TASK_COMM[][2], 1)
+
+"""
+    allgather!(recv::Array{T}, send::Array{T}) -> recv
+
+Gather `send` from every point task of a `collective=true` launch into `recv`, which must
+hold `task_ranks() * length(send)` elements; rank `r`'s data lands at offset
+`r * length(send)`. Every point task of the launch must call it with the same length.
+
+Collectives run over Legate's CPU communicator. The UFI worker executes one point task
+at a time, so a launch may only place one point task per process; otherwise the call
+fails instead of deadlocking.
+"""
+function allgather!(recv::Array{T}, send::Array{T}) where {T}
+    isbitstype(T) || throw(ArgumentError("collectives need an isbits element type, got $T"))
+    n = length(send)
+    length(recv) == task_ranks() * n ||
+        throw(DimensionMismatch("allgather! needs $(task_ranks() * n) elements in recv"))
+    if TASK_COMM[][2] == 0
+        copyto!(recv, 1, send, 1, n)
+        return recv
+    end
+    ok = GC.@preserve recv send ccall(
+        :legate_allgather, Cint,
+        (Ptr{Cvoid}, Ptr{Cvoid}, Int64),
+        send, recv, n * sizeof(T),
+    )
+    ok == 0 && error("Legate UFI: allgather over $(task_ranks()) ranks failed")
+    return recv
+end
+
+"""
+    allreduce!(op, buf::Array) -> buf
+
+Replace `buf` with the elementwise reduction by `op` of `buf` across all point tasks of a
+`collective=true` launch. Built on `allgather!`, so every rank folds the gathered copies
+locally in rank order and ends up with the same result.
+"""
+function allreduce!(op, buf::Array{T}) where {T}
+    p = task_ranks()
+    p == 1 && return buf
+    n = length(buf)
+    gathered = scratch_buffer(T, n * p)
+    allgather!(gathered, buf)
+    for i in 1:n
+        acc = gathered[i]
+        for r in 1:(p - 1)
+            acc = op(acc, gathered[r * n + i])
+        end
+        buf[i] = acc
+    end
+    return buf
+end
+
+"""
+    bcast!(buf::Array, root::Integer=0) -> buf
+
+Overwrite `buf` on every point task of a `collective=true` launch with its contents on
+rank `root`. Built on `allgather!`.
+"""
+function bcast!(buf::Array{T}, root::Integer=0) where {T}
+    p = task_ranks()
+    0 <= root < p || throw(ArgumentError("root $root is not a rank of a $p-rank launch"))
+    p == 1 && return buf
+    n = length(buf)
+    gathered = scratch_buffer(T, n * p)
+    allgather!(gathered, buf)
+    copyto!(buf, 1, gathered, root * n + 1, n)
+    return buf
 end
 
 bool_to_symbol(is_gpu::Bool) = is_gpu ? :gpu : :cpu
@@ -189,12 +871,17 @@ function execute_julia_task(req::TaskRequest)
     end
 
     try
+        TASK_NTHREADS[] = max(Int(req.num_threads), 1)
+        TASK_COMM[] = (Int(req.comm_rank), Int(req.comm_size))
+        TASK_NUMA_NODE[] = Int(req.numa_node)
+        _bind_numa(TASK_NUMA_NODE[])
         Base.invokelatest(_execute_julia_task, Val(bool_to_symbol(req.is_gpu != 0)), req, task_fun)
         yield()
     catch e
         @error "Legate UFI: Julia task failed" exception=(e, catch_backtrace()) req.task_id
         rethrow()
     finally
+        FIRST_TASK_DONE[] || _first_task_done()
         # task is done, decrement counter
         val = Threads.atomic_sub!(PENDING_TASKS, 1)
         if val[] == 1 # atomic_sub returns OLD value, so if old was 1, new is 0
@@ -205,29 +892,50 @@ function execute_julia_task(req::TaskRequest)
     end
 end
 
+const FIRST_TASK_DONE = Ref{Bool}(false)
+
+# Records the time from runtime start to the end of the first Julia task
+function _first_task_done()
+    FIRST_TASK_DONE[] = true
+    _record_phase(:first_task, (time_ns() - STARTUP_T0[]) / 1e9)
+end
+
 # Start the worker
 const WORKER_TASK = Ref{Task}()
-const WORKER_STARTED = Ref{Bool}(false)
+const WORKER_READY = Base.Event()
 
 function _start_worker()
-    # Spawn worker - will run on any available thread, or interleave on main thread
-    WORKER_TASK[] = errormonitor(Threads.@spawn async_worker())
+    # The worker pins its thread to each task's NUMA node and yields between polls, so it
+    # stays on one thread: the last default one, which is not the main thread when there
+    # are two or more
+    tid = last(Threads.threadpooltids(:default))
+    WORKER_TASK[] = errormonitor(_spawn_sticky(async_worker, tid))
 
     @debug "Legate UFI: Worker task spawned"
 
-    # Wait until worker is ready
-    while !WORKER_STARTED[]
-        sleep(0.01)
-    end
+    # async_worker notifies once it is about to poll
+    wait(WORKER_READY)
 
     @debug "Legate UFI: Worker confirmed started and waiting"
 end
 
+# Runs the request-unpacking trampoline once on an empty request, so the first real
+# task does not pay for compiling it
+function _warm_up_ufi()
+    _execute_julia_task(Val(:cpu), TaskRequest(), CPUWrapType(_ -> nothing))
+    return nothing
+end
+
 # Initialize and start worker on INTERACTIVE thread loop
 function init_ufi()
+    # a call blocking the main thread (e.g. `Array(x)`) can wait on a Julia task, which
+    # then needs another thread to run on
+    Threads.nthreads() > 1 || @warn "Legate UFI: Julia tasks need at least 2 Julia \
+        threads (e.g. `julia -t 2`); with one, waiting on a Julia task deadlocks"
     init_task = Threads.@spawn :interactive begin
         CURRENT_REQUEST[] = TaskRequest()
-        _start_worker()
+        _timed_phase(_start_worker, :worker_handshake)
+        _timed_phase(_warm_up_ufi, :warm_up)
     end
     wait(init_task)
 end
@@ -251,3 +959,9 @@ function shutdown_ufi()
     UFI_SHUTDOWN_DONE[] = true
     wait(WORKER_TASK[])
 end
+
+# Compile the UFI trampolines into the package image
+precompile(async_worker, ())
+precompile(execute_julia_task, (TaskRequest,))
+precompile(_execute_julia_task, (Val{:cpu}, TaskRequest, CPUWrapType))
+precompile(_execute_julia_task, (Val{:cpu}, TaskRequest, CPURetWrapType))
@@ -87,8 +87,27 @@ function Base.copyto!(
     dest_ptr = Ptr{T}(Legate.get_ptr(phys_dest))
     src_ptr = Ptr{T}(Legate.get_ptr(phys_src))
 
-    Base.unsafe_copyto!(dest_ptr, src_ptr, prod(size(dest)))
-    return dest
+    dims = size(dest)
+    dest_strides = NTuple{N,Int}(Legate.element_strides(phys_dest))
+    src_strides = NTuple{N,Int}(Legate.element_strides(phys_src))
+    if Legate._is_row_major(dest_strides, dims) && Legate._is_row_major(src_strides, dims)
+        Base.unsafe_copyto!(dest_ptr, src_ptr, prod(dims))
+    else
+        # transposed, projected or broadcast views are not dense row-major
+        _copy_strided!(dest_ptr, dest_strides, src_ptr, src_strides, dims)
+    end
+    return _written!(dest)
+end
+
+function _copy_strided!(
+    dest::Ptr{T}, dest_strides::Dims{N}, src::Ptr{T}, src_strides::Dims{N}, dims::Dims{N}
+) where {T,N}
+    for I in CartesianIndices(dims)
+        c = Tuple(I) .- 1
+        x = unsafe_load(src, sum(c .* src_strides; init=0) + 1)
+        unsafe_store!(dest, x, sum(c .* dest_strides; init=0) + 1)
+    end
+    return nothing
 end
 
 # Julia F-order buffer of shape reverse(S) has the same bytes as C-order shape S.
@@ -135,9 +154,10 @@ end
 function (::Type{<:Array{A}})(arr::LogicalArray{A,N}) where {A,N}
     dims = Base.size(arr)
     if arr.order === :col
-        # :col buffer already holds col-major bytes for reverse(dims); copy straight.
+        # :col arrays hold col-major bytes for reverse(dims), which are the C-order
+        # bytes for dims; copy them straight.
         out = Array{A}(undef, reverse(dims))
-        attached = Legate.attach_external_col_major(out; shape=dims)
+        attached = Legate.attach_external_row_major(out; shape=dims)
         copyto!(attached, arr)
         return out
     end
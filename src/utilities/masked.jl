@@ -0,0 +1,62 @@
+#= Copyright 2026 Northwestern University, 
+ *                   Carnegie Mellon University University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author(s): David Krasowska <krasow@u.northwestern.edu>
+ *            Ethan Meitz <emeitz@andrew.cmu.edu>
+=#
+
+export MaskedArray
+
+"""
+    MaskedArray{T,N} <: AbstractArray{Union{Missing,T},N}
+
+Zero-copy view of a nullable Legate array: `values(A)` holds the data and `validity(A)`
+the null mask (`true` = valid, Legate's convention). Indexing yields `missing` for
+invalid elements and assigning `missing` clears the mask. Kernels that want one pass
+over both can loop over `values(A)` and `validity(A)` directly.
+"""
+struct MaskedArray{T,N,A<:AbstractArray{T,N},M<:AbstractArray{Bool,N}} <:
+       AbstractArray{Union{Missing,T},N}
+    data::A
+    mask::M
+
+    function MaskedArray(data::AbstractArray{T,N}, mask::AbstractArray{Bool,N}) where {T,N}
+        size(data) == size(mask) || throw(
+            DimensionMismatch("data size $(size(data)) != mask size $(size(mask))")
+        )
+        return new{T,N,typeof(data),typeof(mask)}(data, mask)
+    end
+end
+
+Base.values(A::MaskedArray) = A.data
+validity(A::MaskedArray) = A.mask
+
+Base.size(A::MaskedArray) = size(A.data)
+Base.IndexStyle(::Type{<:MaskedArray{T,N,A}}) where {T,N,A} = IndexStyle(A)
+
+Base.@propagate_inbounds function Base.getindex(A::MaskedArray, i::Int...)
+    return A.mask[i...] ? A.data[i...] : missing
+end
+
+Base.@propagate_inbounds function Base.setindex!(A::MaskedArray, ::Missing, i::Int...)
+    A.mask[i...] = false
+    return A
+end
+
+Base.@propagate_inbounds function Base.setindex!(A::MaskedArray, v, i::Int...)
+    A.data[i...] = v
+    A.mask[i...] = true
+    return A
+end
@@ -58,7 +58,70 @@ global const code_type_map = Dict{Int,Type}(
     Int(Legate.STRING) => String, # CxxString?
 )
 
-to_legate_type(T::Type) = Legate.type_map[T]()
+to_legate_type(T::Type) = haskey(type_map, T) ? type_map[T]() : compound_type(T)
+
+# Legate types built for isbits structs and tuples. Struct types get a fresh uid each
+# time one is built, so each Julia type is built once; the reverse map lets a task turn
+# the uid of a STRUCT/FIXED_ARRAY/BINARY argument back into the Julia type.
+const COMPOUND_TYPES = Dict{DataType,LegateType}()
+const COMPOUND_UIDS = Dict{UInt32,DataType}()
+const COMPOUND_LOCK = ReentrantLock()
+
+"""
+    compound_type(T::Type) -> LegateType
+
+The Legate type for the isbits struct or tuple `T`: a `fixed_array_type` for
+homogeneous tuples, else a `struct_type` over the fields. When Legate's aligned layout
+would not match Julia's (e.g. a field type without a Legate equivalent), `T` becomes an
+opaque `binary_type` of `sizeof(T)` bytes instead. Binary types of equal size share a
+uid, so a task could not tell two such Julia types apart: building the second one throws
+an `ArgumentError`. Tasks see arrays of `T` as `Array{T}`.
+"""
+function compound_type(T::Type)
+    (isbitstype(T) && sizeof(T) > 0) ||
+        throw(ArgumentError("$T has no Legate type: only non-empty isbits types are supported"))
+    lock(COMPOUND_LOCK) do
+        get!(COMPOUND_TYPES, T) do
+            ty = _layout_type(T)
+            id = uid(ty) # cxxwrap call
+            prev = get(COMPOUND_UIDS, id, T)
+            prev === T || throw(
+                ArgumentError(
+                    "$T and $prev would both be passed to tasks as opaque $(sizeof(T))-byte " *
+                    "values, so tasks could not tell them apart",
+                ),
+            )
+            COMPOUND_UIDS[id] = T
+            ty
+        end
+    end
+end
+
+function _layout_type(T::Type)
+    n = fieldcount(T)
+    ty = if n == 0
+        nothing
+    elseif T <: Tuple && allequal(fieldtypes(T))
+        fixed_array_type(to_legate_type(fieldtype(T, 1)), UInt32(n)) # cxxwrap call
+    else
+        fields = CxxWrap.StdVector([to_legate_type(fieldtype(T, i)) for i in 1:n])
+        struct_type(fields, true) # cxxwrap call
+    end
+    (isnothing(ty) || type_size(ty) != sizeof(T)) && return binary_type(UInt32(sizeof(T)))
+    return ty
+end
+
+"""
+    compound_julia_type(uid::Integer) -> Union{DataType,Nothing}
+
+The Julia type a compound Legate type with `uid` was built from by `compound_type`, or
+`nothing` if it was not built from Julia.
+"""
+function compound_julia_type(uid::Integer)
+    lock(COMPOUND_LOCK) do
+        return get(COMPOUND_UIDS, UInt32(uid), nothing)
+    end
+end
 
 # This is the same function as the above. 
 # TODO, check if anycode depends on LType calls.
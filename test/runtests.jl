@@ -19,8 +19,10 @@ end
 
 include("tests/hdf5.jl")
 include("tests/stability.jl")
+include("tests/native.jl")
+include("tests/pool.jl")
 
-# include("tests/tasking.jl")
+include("tests/tasking.jl")
 # if run_gpu_tests
 #     include("tests/tasking_gpu.jl")
 # end
@@ -0,0 +1,309 @@
+@testset verbose = true "Native Reductions" begin
+    x = rand(1000)
+    lx = Legate.LogicalArray(x)
+    @test sum(lx) ≈ sum(x)
+    @test minimum(lx) == minimum(x)
+    @test maximum(lx) == maximum(x)
+    @test Legate.norm(lx) ≈ sqrt(sum(abs2, x))
+    @test fetch(Legate.reduce_async(:*, Legate.LogicalArray(fill(2.0, 10)))) == 1024.0
+
+    i = Int32.(rand(-100:100, 257))
+    li = Legate.LogicalArray(i)
+    @test sum(li) == sum(i)
+    @test minimum(li) == minimum(i)
+    @test argmin(li) == argmin(i)
+    @test argmax(li) == argmax(i)
+
+    # distinct values so tie-breaking does not matter
+    m = reshape(Float64.(mod.(7 .* (1:48), 48)), 6, 8)
+    lm = Legate.LogicalArray(m)
+    @test argmax(lm) == argmax(m)
+    @test argmin(lm) == argmin(m)
+
+    @test_throws ArgumentError maximum(Legate.LogicalArray(Float64[]))
+    @test_throws ArgumentError Legate.reduce_async(:foo, lx)
+end
+
+@testset verbose = true "Native Elementwise" begin
+    a = rand(Float32, 40, 25)
+    b = rand(Float32, 40, 25)
+    la = Legate.LogicalArray(a)
+    lb = Legate.LogicalArray(b)
+
+    @test Array(la + lb) ≈ a + b
+    @test Array(la - lb) ≈ a - b
+    @test Array(-la) == -a
+    @test Array(la * 2.5f0) ≈ a * 2.5f0
+    @test Array(la / 2) ≈ a / 2
+    @test Array(Legate.binary_op(:max, la, lb)) == max.(a, b)
+    @test Array(Legate.unary_op(:sqrt, la)) ≈ sqrt.(a)
+    @test Array(Legate.compare(:<, la, lb)) == (a .< b)
+    @test Array(Legate.cast(Float64, la)) == Float64.(a)
+
+    ly = Legate.LogicalArray(copy(b))
+    Legate.axpy!(3, la, ly)
+    @test Array(ly) ≈ 3 .* a .+ b
+
+    @test_throws DimensionMismatch la + Legate.LogicalArray(rand(Float32, 3))
+    @test_throws ArgumentError Legate.unary_op(:sqrt, Legate.LogicalArray([1, 2, 3]))
+    @test_throws ArgumentError Legate.binary_op(:/, Legate.LogicalArray([1, 2, 3]), 0)
+end
+
+@testset verbose = true "Native Generators" begin
+    @test Array(Legate.full((4, 3), 2.5)) == fill(2.5, 4, 3)
+    @test Array(fill!(Legate.LogicalArray(zeros(Int32, 7)), 3)) == fill(Int32(3), 7)
+    @test Array(Legate.iota(Int64, 10; start=5, step=2)) == collect(5:2:23)
+
+    u = Array(Legate.random(Float64, 100, 50; seed=42))
+    @test all(x -> 0 <= x < 1, u)
+    @test u == Array(Legate.random(Float64, 100, 50; seed=42))
+    @test u != Array(Legate.random(Float64, 100, 50; seed=43))
+
+    z = Array(Legate.random(Float32, 100_000; dist=:normal, seed=7))
+    @test abs(sum(z) / length(z)) < 0.02
+    @test abs(sum(abs2, z) / length(z) - 1) < 0.02
+end
+
+@testset verbose = true "Native Scans and Sorting" begin
+    x = Int32.(mod.(37 .* (1:5000), 101)) .- Int32(50)
+    lx = Legate.LogicalArray(x)
+    @test Array(cumsum(lx)) == cumsum(x)
+    @test Array(Legate.scan(:max, lx)) == accumulate(max, x)
+
+    @test Array(sort(lx)) == sort(x)
+    # many repeated keys, so this also checks stability
+    @test Array(sortperm(lx)) == sortperm(x)
+
+    f = Float64.(mod.(7919 .* (1:3001), 3001)) ./ 3001
+    lf = Legate.LogicalArray(f)
+    @test Array(cumsum(lf)) ≈ cumsum(f)
+    @test Array(sort(lf)) == sort(f)
+
+    g = copy(f)
+    g[1:97:end] .= NaN
+    g[2:89:end] .= -0.0
+    lg = Legate.LogicalArray(g)
+    @test isequal(Array(sort(lg)), sort(g))
+    @test Array(sortperm(lg)) == sortperm(g)
+
+    le = Legate.create_array([0], Float64)
+    @test Array(sort(le)) == Float64[]
+    @test Array(sortperm(le)) == Int64[]
+end
+
+@testset verbose = true "Sparse CSR" begin
+    # tridiagonal with an empty row and a dense-ish last row
+    n = 200
+    A = zeros(Float64, n, n)
+    for i in 1:n
+        i == 50 && continue
+        A[i, i] = 2.0
+        i > 1 && (A[i, i - 1] = -1.0)
+        i < n && (A[i, i + 1] = -1.0)
+    end
+    A[n, 1:7:n] .= 0.5
+    S = Legate.CSRMatrix(A)
+    @test size(S) == (n, n)
+    @test Legate.nnz(S) == count(!iszero, A)
+
+    x = collect(range(0.0, 1.0; length=n))
+    @test Array(S * Legate.LogicalArray(x)) ≈ A * x
+
+    @test_throws DimensionMismatch S * Legate.LogicalArray(rand(n + 1))
+end
+
+@testset verbose = true "Placement Control" begin
+    x = rand(256)
+    lx = Legate.LogicalArray(x)
+    Legate.prefetch(lx, Legate.SYSMEM)
+    Legate.offload_to(lx, Legate.SYSMEM)
+    @test Array(lx) == x
+    @test_throws ErrorException Legate.prefetch(lx, Legate.ZCMEM)
+end
+
+@testset verbose = true "Out-of-Core Arrays" begin
+    path = tempname()
+    fa = Legate.file_array(path, Float64, 1000, 4)
+    @test size(fa) == (1000, 4)
+    @test filesize(path) == 1000 * 4 * sizeof(Float64)
+
+    fill!(fa.array, 2.0)
+    cache = Legate.TileCache(fa; tile_rows=300, capacity=2)
+    @test Legate.ntiles(cache) == 4
+
+    sizes = Int[]
+    total = Ref(0.0)
+    Legate.stream_tiles(cache) do t
+        push!(sizes, size(t, 1))
+        total[] += sum(t)
+    end
+    @test sizes == [300, 300, 300, 100]
+    @test total[] == 2.0 * 1000 * 4
+    @test length(cache.resident) == 2
+    @test cache.evictions == 2
+
+    @test_throws BoundsError Legate.require!(cache, 5)
+    @test_throws ArgumentError Legate.file_array(tempname(), Float64, 0)
+end
+
+@testset verbose = true "In-flight Window" begin
+    Legate.set_inflight_limits!(; max_ops=4, max_bytes=1 << 20)
+    try
+        a = Legate.LogicalArray(ones(1024))
+        peak = 0
+        for _ in 1:32
+            a = a + a * 0.5
+            peak = max(peak, Legate.inflight().ops)
+        end
+        @test peak <= 4
+        @test Array(a) ≈ fill(1.5^32, 1024)
+    finally
+        Legate.set_inflight_limits!()
+    end
+    @test_throws ArgumentError Legate.set_inflight_limits!(; max_ops=0)
+end
+
+@testset verbose = true "Ready Events" begin
+    a = Legate.random(Float64, 4096)
+    b = a * 2.0
+    ev = Legate.ready_event(b)
+    wait(ev)
+    @test isready(ev)
+    @test Array(b) ≈ 2.0 .* Array(a)
+
+    # waiting from a Julia task leaves the caller free to run
+    c = b + a
+    t = @async (wait(c); sum(c))
+    @test fetch(t) ≈ 3.0 * sum(Array(a))
+end
+
+@testset verbose = true "Arrow Interop" begin
+    x = rand(100)
+    array, schema = Legate.to_arrow(Legate.LogicalArray(x))
+    @test array[].length == 100
+    @test unsafe_string(schema[].format) == "g"
+
+    y = Legate.from_arrow(array, schema)
+    @test array[].release == C_NULL # moved into Legate
+    Legate.release!(schema)
+    @test Array(y) == x
+
+    # a column produced on the Julia side, sliced by the Arrow offset
+    values = Int32.(0:9)
+    buffers = Ptr{Cvoid}[C_NULL, pointer(values)]
+    noop = @cfunction(a -> nothing, Cvoid, (Ptr{Legate.ArrowArray},))
+    fmt = "i"
+    GC.@preserve values buffers fmt begin
+        col = Ref(
+            Legate.ArrowArray(
+                8, 0, 2, 2, 0, pointer(buffers), C_NULL, C_NULL, noop, C_NULL
+            ),
+        )
+        sch = Ref(Legate.ArrowSchema())
+        sch[] = Legate.ArrowSchema(
+            pointer(fmt), C_NULL, C_NULL, 0, 0, C_NULL, C_NULL, C_NULL, C_NULL
+        )
+        z = Legate.from_arrow(col, sch)
+        @test size(z) == (8,)
+        @test Array(z) == Int32.(2:9)
+    end
+end
+
+@testset verbose = true "Startup Timings" begin
+    phases = first.(Legate.startup_timings())
+    @test :dlopen in phases
+    @test :start_legate in phases
+    # recorded by init_ufi while the runtime starts
+    @test :worker_handshake in phases
+    @test :warm_up in phases
+    @test all(t -> t >= 0, last.(Legate.startup_timings()))
+end
+
+@testset verbose = true "Checkpoints" begin
+    dir = mktempdir()
+    field = Float64[sin(i / 50) + cos(j / 70) for i in 1:200, j in 1:64]
+    a = Legate.LogicalArray(field)
+    Legate.write_checkpoint(dir, a)
+    b = Legate.read_checkpoint(dir)
+    @test eltype(b) == Float64
+    @test size(b) == size(a)
+    @test Array(b) == Array(a)
+    Legate.runtime_sync()
+    @test isfile(joinpath(dir, "manifest"))
+    stored = sum(f -> filesize(joinpath(dir, f)), filter(endswith(".lgc"), readdir(dir)))
+    @test stored < sizeof(field)
+
+    ints = Legate.LogicalArray(collect(Int32, 1:1000))
+    Legate.write_checkpoint(joinpath(dir, "ints"), ints)
+    @test Array(Legate.read_checkpoint(joinpath(dir, "ints"))) == collect(Int32, 1:1000)
+
+    @test_throws ArgumentError Legate.write_checkpoint(
+        joinpath(dir, "halves"), Legate.LogicalArray(Float16[1, 2, 3])
+    )
+    # a lost block is caught before any decode is submitted
+    rm(joinpath(dir, "ints", "tile_0.lgc"))
+    @test_throws ErrorException Legate.read_checkpoint(joinpath(dir, "ints"))
+end
+
+@testset verbose = true "Write Versions" begin
+    Legate.track_writes!()
+    x = Legate.full((16,), 1.0)
+    v = Legate.write_version(x)
+    @test v > 0
+    y = x + x
+    @test Legate.write_version(x) == v
+    Legate.axpy!(2.0, y, x)
+    @test Legate.write_version(x) > v
+
+    # manual-launch outputs and reductions on a partition count against its store
+    s = Legate.create_store([16], Float64)
+    p = Legate.partition_by_tiling(s, [4])
+    v = Legate.write_version(s)
+    Legate._written!(p)
+    @test Legate.write_version(s) > v
+end
+
+@testset verbose = true "Lazy Views" begin
+    A = reshape(collect(Float64, 1:24), 4, 6)
+    x = Legate.LogicalArray(A)
+
+    @test size(transpose(x)) == (6, 4)
+    @test Array(transpose(x)) == permutedims(A)
+    @test Array(PermutedDimsArray(x, (2, 1))) == permutedims(A)
+
+    @test Array(x[2:3, :]) == A[2:3, :]
+    @test Array(view(x, :, 5)) == A[:, 5]
+    @test Array(x[2:4, 3:6]) == A[2:4, 3:6]
+    @test x[3, 5] == A[3, 5]
+    @test_throws BoundsError x[5, 1]
+
+    @test Array(Legate.delinearize(x, 2, (2, 3))) == permutedims(reshape(A, 4, 3, 2), (1, 3, 2))
+    row = Legate.LogicalArray(reshape(collect(Float64, 1:6), 1, 6))
+    @test Array(Legate.broadcast_view(row, 1, 3)) == repeat(reshape(1.0:6.0, 1, 6), 3, 1)
+    @test_throws DimensionMismatch Legate.broadcast_view(x, 1, 3)
+
+    # views of a column-major array index `Array(xc)`, not the store
+    xc = Legate.LogicalArray{Float64,2}(x.handle, x.dims, :col)
+    Ac = Array(xc)
+    @test Ac == permutedims(A)
+    @test xc[2:3, :].order === :col
+    @test Array(xc[2:3, :]) == Ac[2:3, :]
+    @test Array(view(xc, :, 3)) == Ac[:, 3]
+    @test Array(xc[2:5, 2:3]) == Ac[2:5, 2:3]
+    @test xc[5, 2] == Ac[5, 2]
+    @test Array(Legate.project(xc, 1, 2)) == Ac[2, :]
+    @test Array(transpose(xc)) == A
+    B = reshape(collect(Float64, 1:24), 2, 3, 4)
+    yc = Legate.LogicalArray{Float64,3}(Legate.LogicalArray(B).handle, (2, 3, 4), :col)
+    @test Array(permutedims(yc, (2, 1, 3))) == permutedims(Array(yc), (2, 1, 3))
+
+    # views write through to their source
+    copyto!(x[1:2, 1:2], Legate.LogicalArray(zeros(2, 2)))
+    @test Array(x)[1:2, 1:2] == zeros(2, 2)
+    @test Array(x)[3:4, :] == A[3:4, :]
+
+    # ... and count as writes to it
+    v = Legate.write_version(x)
+    fill!(x[3:4, :], 1.0)
+    @test Legate.write_version(x) > v
+end
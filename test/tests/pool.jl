@@ -0,0 +1,33 @@
+@testset verbose = true "Store Pool" begin
+    pool = Legate.StorePool(; max_per_key=2)
+    a = Legate.acquire!(pool, (8, 4), Float64)
+    @test size(a) == (8, 4)
+    @test Legate.pool_stats(pool) == (; hits=0, misses=1, pooled=0)
+
+    Legate.release!(pool, a)
+    @test_throws ArgumentError Legate.release!(pool, a)
+    b = Legate.acquire!(pool, (8, 4), Float64)
+    @test b.handle === a.handle
+
+    # a recycled array comes back row-major whatever order it was released with
+    Legate.release!(pool, Legate.LogicalArray{Float64,2}(b.handle, b.dims, :col))
+    b = Legate.acquire!(pool, (8, 4), Float64)
+    @test b.handle === a.handle && b.order === :row
+    @test Legate.pool_stats(pool).hits == 2
+
+    # a different type, shape or nullability is a different key
+    c = Legate.acquire!(pool, (8, 4), Float32)
+    d = Legate.acquire!(pool, (8, 4), Float64; nullable=true)
+    @test Legate.pool_stats(pool).misses == 3
+
+    result = Legate.with_temporary(pool, (8, 4), Float64) do t
+        fill!(t, 1.0)
+        sum(t)
+    end
+    @test result == 32.0
+
+    foreach(x -> Legate.release!(pool, x), (b, c, d))
+    @test Legate.pool_stats(pool).pooled == 3
+    empty!(pool)
+    @test Legate.pool_stats(pool) == (; hits=0, misses=0, pooled=0)
+end
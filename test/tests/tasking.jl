@@ -68,6 +68,78 @@ function task_scalar(args::Vector{Legate.TaskArgument})
     end
 end
 
+# Task returning a scalar, reduced across point tasks into a Future
+function task_sum(args::Vector{Legate.TaskArgument})
+    a = args[1]
+    acc = 0.0
+    @inbounds @simd for i in eachindex(a)
+        acc += a[i]
+    end
+    return acc
+end
+
+# Filter task writing only the positive elements into an unbound output
+function task_filter_positive(args::Vector{Legate.TaskArgument})
+    a, out = args
+    n = count(>(0.5f0), a)
+    buf = Legate.create_output_buffer(out, n)
+    j = 1
+    @inbounds for x in a
+        if x > 0.5f0
+            buf[j] = x
+            j += 1
+        end
+    end
+end
+
+# Stages its result in a scratch workspace instead of a GC allocation
+function task_scratch_double(args::Vector{Legate.TaskArgument})
+    a, b = args
+    tmp = Legate.scratch_buffer(eltype(a), size(a)...)
+    @inbounds for i in eachindex(a)
+        tmp[i] = 2 * a[i]
+    end
+    copyto!(b, tmp)
+end
+
+# Requests scratch buffers from several Julia threads of one task at once
+function task_scratch_concurrent(args::Vector{Legate.TaskArgument})
+    a, b = args
+    halves = Iterators.partition(eachindex(a), cld(length(a), 2))
+    @sync for r in halves
+        Threads.@spawn begin
+            tmp = Legate.scratch_buffer(eltype(a), length(r))
+            tmp .= 2 .* view(a, r)
+            b[r] .= tmp
+        end
+    end
+end
+
+# Nullable task: doubles valid elements, propagates nulls in one pass
+function task_masked_double(args::Vector{Legate.TaskArgument})
+    a, b = args
+    @inbounds for i in eachindex(a)
+        b[i] = ismissing(a[i]) ? missing : 2 * a[i]
+    end
+end
+
+# Fills a nullable output with i at odd positions and nulls at even ones
+function task_masked_fill(args::Vector{Legate.TaskArgument})
+    a, = args
+    @inbounds for i in eachindex(a)
+        a[i] = iseven(i) ? missing : Float32(i)
+    end
+end
+
+# Splits a nullable input into its values (0 for nulls) and its validity
+function task_masked_split(args::Vector{Legate.TaskArgument})
+    a, vals, valid = args
+    @inbounds for i in eachindex(a)
+        valid[i] = !ismissing(a[i])
+        vals[i] = valid[i] ? a[i] : 0.0f0
+    end
+end
+
 # get ground truth from base julia
 base_results = run_base_julia_test()
 
@@ -77,6 +149,85 @@ expected_b = base_results.a_init .* 2
 expected_d = expected_c .+ 1
 expected_a = expected_c .* 2.5f0
 
+struct Particle
+    x::Float64
+    m::Float32
+    id::Int32
+end
+
+# writes Particle(i, 2, i) into a struct-typed output
+function task_make_particles(args::Vector{Legate.TaskArgument})
+    p = args[1]
+    for i in eachindex(p)
+        p[i] = Particle(i, 2.0f0, i)
+    end
+end
+
+# out = m * x of each record
+function task_particle_moment(args::Vector{Legate.TaskArgument})
+    p, out = args
+    for i in eachindex(p)
+        out[i] = p[i].m * p[i].x
+    end
+end
+
+# out = byte length of each string, read through a VarSizeVector
+function task_string_lengths(args::Vector{Legate.TaskArgument})
+    s, out = args
+    for i in eachindex(s)
+        out[i] = length(s[i])
+    end
+end
+
+struct AffineParams
+    scale::Float32
+    shift::Float32
+    taps::NTuple{3,Int32}
+end
+
+# No Legate equivalent, so both become the same opaque 6-byte binary type
+primitive type Opaque48A 48 end
+primitive type Opaque48B 48 end
+
+# out = p.scale * a + p.shift + sum(p.taps), with every parameter in one struct scalar
+function task_affine(args::Vector{Legate.TaskArgument})
+    a, out, p = args
+    offset = p.shift + sum(p.taps)
+    out .= p.scale .* a .+ offset
+end
+
+# out = a .^ 2
+function task_square(args::Vector{Legate.TaskArgument})
+    a, out = args
+    out .= a .^ 2
+end
+
+# out = NUMA node the task body ran on
+function task_numa_node(args::Vector{Legate.TaskArgument})
+    out, = args
+    out .= Legate.task_numa_node()
+end
+
+# out = 108 * ranks when every rank gets rank 0's buffer and gathers the same values
+function task_collective_probe(args::Vector{Legate.TaskArgument})
+    _, out = args
+    p = Legate.task_ranks()
+    0 <= Legate.task_rank() < p || return out .= -1
+    buf = Float32[Legate.task_rank() + 1, 7]
+    Legate.bcast!(buf, 0)
+    gathered = Vector{Float32}(undef, 2p)
+    Legate.allgather!(gathered, buf)
+    out .= 100p + sum(gathered)
+end
+
+# out = sum of a over every point task, combined with a CPU collective
+function task_global_sum(args::Vector{Legate.TaskArgument})
+    a, out = args
+    total = [Float64(sum(a))]
+    Legate.allreduce!(+, total)
+    out .= Float32(total[1])
+end
+
 @testset verbose=true "CPU Tasking" begin
     rt = Legate.get_runtime()
     lib = Legate.create_library("test_comparison")
@@ -86,10 +237,12 @@ expected_a = expected_c .* 2.5f0
     my_scalar_task = Legate.wrap_task(task_scalar)
 
     function set_legate_array(rt, lib, legate_arr, values)
+        # a task argument's linear index walks the tile in Legate's row-major order
+        row_major = vec(permutedims(values))
         function set_task(args::Vector{Legate.TaskArgument})
             arr = args[1]
             @inbounds @simd for i in eachindex(arr)
-                arr[i] = values[i]
+                arr[i] = row_major[i]
             end
         end
         set_wrapped = Legate.wrap_task(set_task)
@@ -115,6 +268,8 @@ expected_a = expected_c .* 2.5f0
         val_b = Array(b)
         @test val_a ≈ base_results.a_init
         @test val_b ≈ base_results.b_init
+        # recorded once the first Julia task has finished
+        @test :first_task in first.(Legate.startup_timings())
     end
 
     a = Legate.create_array([10, 10], Float32)
@@ -167,4 +322,201 @@ expected_a = expected_c .* 2.5f0
         val_a = Array(a)
         @test val_a ≈ expected_a
     end
+
+    @testset "Return Value Task (Future)" begin
+        sum_task = Legate.wrap_task(task_sum; return_type=Float64)
+        result = Legate.Future(Float64, :+)
+        task5 = Legate.create_julia_task(rt, lib, sum_task; result=result)
+        Legate.add_input(task5, c)
+        Legate.submit_task(rt, task5)
+        @test fetch(result) ≈ sum(Float64, expected_c)
+        # only element types the host-side return reduction handles
+        @test_throws MethodError Legate.Future(Float16, :+)
+        @test_throws MethodError Legate.Future(Bool, :+)
+    end
+
+    @testset "Unbound Output Task" begin
+        filter_task = Legate.wrap_task(task_filter_positive)
+        filtered = Legate.create_array(Float32)
+        task6 = Legate.create_julia_task(rt, lib, filter_task)
+        Legate.add_input(task6, c)
+        Legate.add_output(task6, filtered)
+        Legate.submit_task(rt, task6)
+        expected = filter(>(0.5f0), vec(expected_c))
+        @test sort(Array(filtered)) ≈ sort(expected)
+        # outside a task there is no Legate task to bind the buffer to
+        @test_throws ErrorException Legate.create_output_buffer(
+            Legate.UnboundOutput{Float32}(0, false), 4
+        )
+    end
+
+    @testset "Eager Inline Launch" begin
+        e_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, my_scalar_task, [c], [e_out];
+            scalars=(2.5f0,), eager=true)
+        @test Array(e_out) ≈ expected_a
+
+        Legate.set_eager_threshold!(1000)
+        t_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, my_task, [a, b], [t_out])
+        @test Array(t_out) ≈ Array(a) .+ Array(b)
+        Legate.set_eager_threshold!(0)
+    end
+
+    @testset "Scratch Buffer" begin
+        scratch_task = Legate.wrap_task(task_scratch_double)
+        s_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, scratch_task, [c], [s_out]; eager=false)
+        @test Array(s_out) ≈ 2 .* Array(c)
+        # the inline path has no Legate task and falls back to a Julia array
+        i_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, scratch_task, [c], [i_out]; eager=true)
+        @test Array(i_out) ≈ 2 .* Array(c)
+        concurrent_task = Legate.wrap_task(task_scratch_concurrent)
+        t_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, concurrent_task, [c], [t_out]; eager=false)
+        @test Array(t_out) ≈ 2 .* Array(c)
+        @test_throws ErrorException Legate.scratch_buffer(Float32, 4)
+    end
+
+    @testset "parallel_chunks" begin
+        hits = zeros(Int, 100)
+        Legate.parallel_chunks(1:100) do r
+            hits[r] .+= 1
+        end
+        @test all(==(1), hits)
+    end
+
+    @testset "MaskedArray" begin
+        data = Float32[1, 2, 3, 4]
+        mask = Bool[true, false, true, false]
+        m = Legate.MaskedArray(data, mask)
+        @test isequal(collect(m), [1.0f0, missing, 3.0f0, missing])
+        m[2] = 5.0f0
+        m[3] = missing
+        @test mask == Bool[true, true, false, false]
+        @test data[2] == 5.0f0
+
+        fill_task = Legate.wrap_task(task_masked_fill)
+        double_task = Legate.wrap_task(task_masked_double)
+        split_task = Legate.wrap_task(task_masked_split)
+        src = Legate.create_array([8], Float32; nullable=true)
+        dst = Legate.create_array([8], Float32; nullable=true)
+        vals = Legate.create_array([8], Float32)
+        valid = Legate.create_array([8], Bool)
+        Legate.launch_julia_task(rt, lib, fill_task, Legate.LogicalArray[], [src]; eager=false)
+        Legate.launch_julia_task(rt, lib, double_task, [src], [dst]; eager=false)
+        Legate.launch_julia_task(rt, lib, split_task, [dst], [vals, valid]; eager=false)
+        @test Array(valid) == isodd.(1:8)
+        @test Array(vals) == Float32[isodd(i) ? 2i : 0 for i in 1:8]
+    end
+
+    @testset "Struct and String Arguments" begin
+        particles = Legate.create_array([16], Particle)
+        make_task = Legate.wrap_task(task_make_particles)
+        Legate.launch_julia_task(rt, lib, make_task, Legate.LogicalArray[], [particles])
+        moment = Legate.create_array([16], Float64)
+        moment_task = Legate.wrap_task(task_particle_moment)
+        Legate.launch_julia_task(rt, lib, moment_task, [particles], [moment])
+        @test Array(moment) ≈ 2.0 .* (1:16)
+
+        chars = Vector{UInt8}("abcdefghij")
+        offsets = Int32[0, 3, 3, 10]
+        buffers = Ptr{Cvoid}[C_NULL, pointer(offsets), pointer(chars)]
+        noop = @cfunction(a -> nothing, Cvoid, (Ptr{Legate.ArrowArray},))
+        fmt = "u"
+        GC.@preserve chars offsets buffers fmt begin
+            col = Ref(
+                Legate.ArrowArray(
+                    3, 0, 0, 3, 0, pointer(buffers), C_NULL, C_NULL, noop, C_NULL
+                ),
+            )
+            sch = Ref(
+                Legate.ArrowSchema(
+                    pointer(fmt), C_NULL, C_NULL, 0, 0, C_NULL, C_NULL, C_NULL, C_NULL
+                ),
+            )
+            strings = Legate.from_arrow(col, sch)
+            lengths = Legate.create_array([3], Int64)
+            lengths_task = Legate.wrap_task(task_string_lengths)
+            Legate.launch_julia_task(rt, lib, lengths_task, [strings], [lengths])
+            @test Array(lengths) == [3, 0, 7]
+            @test_throws ArgumentError Legate.launch_julia_task(
+                rt, lib, lengths_task, [lengths], [strings]
+            )
+        end
+    end
+
+    @testset "Struct Scalars" begin
+        params = AffineParams(2.0f0, 0.5f0, (1, 2, 3))
+        @test Legate.to_scalar(1.5f0) isa Legate.Scalar
+        affine_task = Legate.wrap_task(task_affine)
+        p_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, affine_task, [c], [p_out]; scalars=(params,), eager=false)
+        @test Array(p_out) ≈ 2 .* Array(c) .+ 6.5f0
+
+        # tasks could not tell the two types apart, so only the first one is accepted
+        Legate.compound_type(Opaque48A)
+        @test_throws ArgumentError Legate.compound_type(Opaque48B)
+        @test_throws ArgumentError Legate.to_scalar(reinterpret(Opaque48B, ntuple(UInt8, 6)))
+    end
+
+    @testset "Collectives" begin
+        # CI runs one CPU per process, so each launch has one point task per rank
+        probe_task = Legate.wrap_task(task_collective_probe)
+        p_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, probe_task, [c], [p_out]; eager=false, collective=true)
+        probes = Array(p_out)
+        @test allequal(probes) && probes[1] > 0 && probes[1] % 108 == 0
+        sum_task = Legate.wrap_task(task_global_sum)
+        s_out = Legate.create_array([10, 10], Float32)
+        Legate.launch_julia_task(rt, lib, sum_task, [c], [s_out]; eager=false, collective=true)
+        @test all(≈(sum(Array(c))), Array(s_out))
+    end
+
+    @testset "Memoized Launches" begin
+        Legate.clear_memo!()
+        square_task = Legate.wrap_task(task_square)
+        m_out = Legate.create_array([10, 10], Float32)
+        run1 = Legate.launch_julia_task(rt, lib, square_task, [c], [m_out]; eager=false, memoize=true)
+        again = Legate.launch_julia_task(
+            rt, lib, square_task, [c], [Legate.create_array([10, 10], Float32)];
+            eager=false, memoize=true,
+        )
+        @test again[1] === run1[1]
+        @test Array(again[1]) ≈ Array(c) .^ 2
+        stats = Legate.memo_stats()
+        @test stats.hits == 1 && stats.misses == 1
+        @test stats.bytes_saved == 100 * sizeof(Float32)
+        fill!(c, 3.0f0) # a write to the input invalidates the entry
+        Legate.launch_julia_task(rt, lib, square_task, [c], [m_out]; eager=false, memoize=true)
+        @test Legate.memo_stats().misses == 2
+        @test all(==(9.0f0), Array(m_out))
+    end
+
+    @testset "NUMA Binding" begin
+        @test Legate.task_numa_node() == -1
+        numa_task = Legate.wrap_task(task_numa_node)
+        n_out = Legate.create_array([10, 10], Int32)
+        Legate.launch_julia_task(rt, lib, numa_task, Legate.LogicalArray[], [n_out]; eager=false)
+        @test all(>=(-1), Array(n_out))
+        Legate.set_numa_binding!(false)
+        Legate.launch_julia_task(rt, lib, numa_task, Legate.LogicalArray[], [n_out]; eager=false)
+        @test all(>=(-1), Array(n_out))
+        Legate.set_numa_binding!(true)
+    end
+
+    @testset "Strided Views" begin
+        square_task = Legate.wrap_task(task_square)
+        A = reshape(collect(Float32, 1:100), 10, 10)
+        t = Legate.LogicalArray(A)
+        for eager in (false, true)
+            v_out = Legate.create_array([10, 10], Float32)
+            Legate.launch_julia_task(rt, lib, square_task, [transpose(t)], [v_out]; eager)
+            @test Array(v_out) == permutedims(A) .^ 2
+        end
+        col_out = Legate.create_array([10], Float32)
+        Legate.launch_julia_task(rt, lib, square_task, [t[:, 4]], [col_out]; eager=false)
+        @test Array(col_out) == A[:, 4] .^ 2
+    end
 end